@@ -0,0 +1,146 @@
+/**
+ * \file AllocStats.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the opt-in counting of heap allocations
+ * \details Replaces the global operator new and delete of the programs it is
+ * linked into, which are only the tests and benchmarks; the engine in src does
+ * not use it. They forward to malloc and free, keep the size asked for in a
+ * header in front of each block, and count only while tracking is on.
+ */
+//Importation
+#include "AllocStats.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+
+namespace {
+
+//Room in front of each block for its size, keeping the block aligned for any type
+const std::size_t HEADER = alignof(std::max_align_t);
+
+std::atomic<bool> tracking(false);
+std::atomic<long long> allocationCount(0);
+std::atomic<long long> freeCount(0);
+std::atomic<long long> byteCount(0);
+std::atomic<long long> liveByteCount(0);
+
+}
+
+/**
+ * \brief Turn the counting of allocations on or off
+ * \details Off by default. The counters are shared by every thread; when off,
+ * operator new and delete cost one relaxed load more than malloc and free.
+ * \param enabled True to count allocations, false to stop
+ */
+void set_alloc_tracking(bool enabled) {
+    tracking.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Check if allocations are being counted
+ * \return True if counting, false otherwise
+ */
+bool alloc_tracking() {
+    return tracking.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Returns the counts since the program started
+ * \return The counts
+ */
+AllocStatsT alloc_stats() {
+    AllocStatsT stats = {allocationCount.load(std::memory_order_relaxed),
+                         freeCount.load(std::memory_order_relaxed),
+                         byteCount.load(std::memory_order_relaxed),
+                         liveByteCount.load(std::memory_order_relaxed)};
+    return stats;
+}
+
+/**
+ * \brief Constructor method for the class, starts counting
+ */
+AllocScopeT::AllocScopeT() : previous(alloc_tracking()) {
+    set_alloc_tracking(true);
+    start = alloc_stats();
+}
+
+/**
+ * \brief Destructor method for the class, restores the tracking setting
+ */
+AllocScopeT::~AllocScopeT() {
+    set_alloc_tracking(previous);
+}
+
+/**
+ * \brief Returns the counts since the scope started
+ * \return The counts
+ */
+AllocStatsT AllocScopeT::stats() const {
+    AllocStatsT now = alloc_stats();
+    AllocStatsT diff = {now.allocations - start.allocations, now.frees - start.frees,
+                        now.bytes - start.bytes, now.liveBytes - start.liveBytes};
+    return diff;
+}
+
+/**
+ * \brief Returns the number of allocations since the scope started
+ * \return The number of allocations
+ */
+long long AllocScopeT::allocations() const {
+    return alloc_stats().allocations - start.allocations;
+}
+
+void *operator new(std::size_t size) {
+    char *block = static_cast<char *>(std::malloc(HEADER + size));
+    if (block == NULL)
+        throw std::bad_alloc();
+    *reinterpret_cast<std::size_t *>(block) = size;
+    if (tracking.load(std::memory_order_relaxed)) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        byteCount.fetch_add(size, std::memory_order_relaxed);
+        liveByteCount.fetch_add(size, std::memory_order_relaxed);
+    }
+    return block + HEADER;
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc &) {
+        return NULL;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+    return operator new(size, std::nothrow);
+}
+
+void operator delete(void *p) noexcept {
+    if (p == NULL)
+        return;
+    char *block = static_cast<char *>(p) - HEADER;
+    if (tracking.load(std::memory_order_relaxed)) {
+        freeCount.fetch_add(1, std::memory_order_relaxed);
+        liveByteCount.fetch_sub(*reinterpret_cast<std::size_t *>(block), std::memory_order_relaxed);
+    }
+    std::free(block);
+}
+
+void operator delete[](void *p) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+    operator delete(p);
+}
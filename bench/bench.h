@@ -0,0 +1,65 @@
+/**
+ * \file bench.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Minimal benchmark harness used by 'make bench'
+ * \details A benchmark body runs the measured operation 'iterations' times;
+ * the harness reports the time and the allocations per iteration.
+ */
+#ifndef A3_BENCH_H_
+#define A3_BENCH_H_
+
+/**
+ * \brief Body of a benchmark, runs the measured operation the given number of times
+ */
+typedef void (*BenchFn)(unsigned long iterations);
+
+/**
+ * \brief Registers a benchmark at static initialisation time
+ */
+struct BenchRegistrar {
+    /**
+     * \brief Register a benchmark
+     * \param name Name printed in the report
+     * \param fn Body of the benchmark
+     */
+    BenchRegistrar(const char *name, BenchFn fn);
+};
+
+/**
+ * \brief Restart the clock and the allocation counts of the running benchmark
+ * \details Called by a benchmark body after its setup, so the setup is not measured.
+ */
+void bench_reset_timer();
+
+/**
+ * \brief Report a figure of the running benchmark besides its times, e.g. the work done per op
+ * \details The values of the last run are printed after the times, by name.
+ * Reporting a name again in the same run replaces its value.
+ * \param name Name printed with the value, a string literal
+ * \param value The value
+ */
+void bench_report(const char *name, double value);
+
+/**
+ * \brief Keeps the compiler from optimising away a computed value
+ * \param value Value being kept
+ */
+template <class T>
+inline void bench_keep(const T &value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+#define BENCH_CONCAT2(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT2(a, b)
+
+/**
+ * \brief Define and register a benchmark. The body sees 'iterations'.
+ */
+#define BENCHMARK(name) \
+    static void BENCH_CONCAT(bench_fn_, __LINE__)(unsigned long iterations); \
+    static BenchRegistrar BENCH_CONCAT(bench_reg_, __LINE__)(name, BENCH_CONCAT(bench_fn_, __LINE__)); \
+    static void BENCH_CONCAT(bench_fn_, __LINE__)(unsigned long iterations)
+
+#endif
@@ -0,0 +1,206 @@
+/**
+ * \file benchBoard.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the validation and move functions of the board
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include <vector>
+
+namespace {
+
+//A position of a dealt game with a tableau move and a waste move available
+struct SampleT {
+    BoardT board;
+    MoveT tab;
+    MoveT waste;
+};
+
+const SampleT &sample() {
+    static SampleT s;
+    static bool ready = false;
+    for (uint64_t seed = 1; !ready; seed++) {
+        s.board = deal_board(seed);
+        MoveT moves[MAX_MOVES];
+        bool tab = false;
+        bool waste = false;
+        while (!waste && s.board.is_valid_deck_mv()) {
+            s.board.deck_mv();
+            unsigned int n = s.board.generate_moves(moves);
+            tab = waste = false;
+            for (unsigned int i = 0; i < n; i++) {
+                if (moves[i].origin_category == Tableau && moves[i].category == Tableau && !tab) {
+                    s.tab = moves[i];
+                    tab = true;
+                }
+                if (moves[i].origin_category == Waste && !waste) {
+                    s.waste = moves[i];
+                    waste = true;
+                }
+            }
+            waste = waste && tab;
+        }
+        ready = waste;
+    }
+    return s;
+}
+
+//Positions 40 random moves into the first deals
+const std::vector<BoardT> &midgames() {
+    static std::vector<BoardT> boards;
+    for (uint64_t deal = 0; boards.size() < 100; deal++) {
+        BoardT board = deal_board(deal);
+        DealRngT random(~deal);
+        MoveT moves[MAX_MOVES];
+        for (int step = 0; step < 40; step++) {
+            unsigned int n = board.generate_moves(moves);
+            if (n == 0)
+                break;
+            board.make(moves[random.bounded(n)]);
+        }
+        boards.push_back(board);
+    }
+    return boards;
+}
+
+}
+
+BENCHMARK("board/is_valid_tab_mv") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        naturalNumber origin = i % TAB_SIZE;
+        bool valid = s.board.is_valid_tab_mv(Tableau, origin, s.tab.destination);
+        bench_keep(valid);
+    }
+}
+
+BENCHMARK("board/is_valid_waste_mv") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        naturalNumber destination = i % TAB_SIZE;
+        bool valid = s.board.is_valid_waste_mv(Tableau, destination);
+        bench_keep(valid);
+    }
+}
+
+BENCHMARK("board/is_valid_deck_mv") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        bool valid = s.board.is_valid_deck_mv();
+        bench_keep(valid);
+    }
+}
+
+BENCHMARK("board/tab_mv+unmake") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        s.board.tab_mv(static_cast<CategoryT>(s.tab.category), s.tab.origin, s.tab.destination);
+        s.board.unmake(s.tab);
+        bench_keep(s.board);
+    }
+}
+
+BENCHMARK("board/waste_mv+unmake") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        s.board.waste_mv(static_cast<CategoryT>(s.waste.category), s.waste.destination);
+        s.board.unmake(s.waste);
+        bench_keep(s.board);
+    }
+}
+
+BENCHMARK("board/deck_mv+unmake") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        s.board.deck_mv();
+        s.board.unmake(deck_move());
+        bench_keep(s.board);
+    }
+}
+
+BENCHMARK("board/valid_mv_exists") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        bool exists = s.board.valid_mv_exists();
+        bench_keep(exists);
+    }
+}
+
+BENCHMARK("board/is_win_state") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        bool won = s.board.is_win_state();
+        bench_keep(won);
+    }
+}
+
+BENCHMARK("board/generate_moves") {
+    SampleT s = sample();
+    MoveT moves[MAX_MOVES];
+    for (unsigned long i = 0; i < iterations; i++) {
+        unsigned int n = s.board.generate_moves(moves);
+        bench_keep(n);
+        bench_keep(moves);
+    }
+}
+
+BENCHMARK("board/canonical_hash") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        uint64_t hash = s.board.canonical_hash();
+        bench_keep(hash);
+    }
+}
+
+BENCHMARK("board/canonical") {
+    SampleT s = sample();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT canonical = s.board.canonical();
+        bench_keep(canonical);
+    }
+}
+
+BENCHMARK("board/auto_play_safe") {
+    const std::vector<BoardT> &boards = midgames();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board = boards[i % boards.size()];
+        std::vector<MoveT> made = board.auto_play_safe();
+        bench_keep(made.size());
+    }
+}
+
+//Every foundation move found by the validators, scanned again until none is left
+BENCHMARK("board/foundation scan with validators") {
+    const std::vector<BoardT> &boards = midgames();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board = boards[i % boards.size()];
+        unsigned int made = 0;
+        bool moved = true;
+        while (moved) {
+            moved = false;
+            for (int j = 0; j < TAB_SIZE; j++) {
+                for (int k = 0; k < FOUND_SIZE; k++) {
+                    if (board.get_tab_size(j) > 0 && board.is_valid_tab_mv(Foundation, j, k)) {
+                        board.tab_mv(Foundation, j, k);
+                        made++;
+                        moved = true;
+                    }
+                }
+            }
+            for (int k = 0; k < FOUND_SIZE; k++) {
+                if (board.get_waste().size() > 0 && board.is_valid_waste_mv(Foundation, k)) {
+                    board.waste_mv(Foundation, k);
+                    made++;
+                    moved = true;
+                }
+            }
+        }
+        bench_keep(made);
+    }
+}
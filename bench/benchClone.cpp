@@ -0,0 +1,80 @@
+/**
+ * \file benchClone.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for cloning a board
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "CardStack.h"
+#include "GameBoard.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+//Same shape as the board before its piles were stored inline
+struct VectorBoardT {
+    CardStackT tableau[TAB_SIZE];
+    CardStackT foundation[FOUND_SIZE];
+    CardStackT deck;
+    CardStackT waste;
+};
+
+BoardT sample_board() {
+    std::vector<CardT> d;
+    for (RankT rank = ACE; rank <= KING; rank++) {
+        for (unsigned int suit = 0; suit < 4; suit++) {
+            CardT n = {static_cast<SuitT>(suit), rank};
+            d.push_back(n);
+            d.push_back(n);
+        }
+    }
+    std::reverse(d.begin(), d.end());
+    BoardT board(d);
+    for (int i = 0; i < 10; i++)
+        board.deck_mv();
+    return board;
+}
+
+VectorBoardT sample_vector_board() {
+    BoardT board = sample_board();
+    VectorBoardT vb;
+    for (int i = 0; i < TAB_SIZE; i++)
+        vb.tableau[i] = board.get_tab(i);
+    for (int i = 0; i < FOUND_SIZE; i++)
+        vb.foundation[i] = board.get_foundation(i);
+    vb.deck = board.get_deck();
+    vb.waste = board.get_waste();
+    return vb;
+}
+
+}
+
+BENCHMARK("clone/BoardT copy") {
+    BoardT board = sample_board();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT clone = board;
+        bench_keep(clone);
+    }
+}
+
+BENCHMARK("clone/BoardT memcpy") {
+    BoardT board = sample_board();
+    BoardT clone;
+    for (unsigned long i = 0; i < iterations; i++) {
+        std::memcpy(&clone, &board, sizeof(BoardT));
+        bench_keep(clone);
+    }
+}
+
+BENCHMARK("clone/vector piles copy") {
+    VectorBoardT board = sample_vector_board();
+    for (unsigned long i = 0; i < iterations; i++) {
+        VectorBoardT clone = board;
+        bench_keep(clone);
+    }
+}
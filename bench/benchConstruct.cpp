@@ -0,0 +1,46 @@
+/**
+ * \file benchConstruct.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for board construction, one op is one board
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include <vector>
+
+BENCHMARK("construct/BoardT(vector<CardT>)") {
+    std::vector<CardT> cards = deal_cards(1);
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board(cards);
+        bench_keep(board);
+    }
+}
+
+BENCHMARK("construct/BoardT(packed, checked)") {
+    PackedCardT packed[TOTAL_CARD];
+    deal_packed(1, packed);
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board(packed);
+        bench_keep(board);
+    }
+}
+
+BENCHMARK("construct/BoardT(packed, unchecked)") {
+    PackedCardT packed[TOTAL_CARD];
+    deal_packed(1, packed);
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board(packed, false);
+        bench_keep(board);
+    }
+}
+
+BENCHMARK("construct/deal_board(seed)") {
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board = deal_board(i);
+        bench_keep(board);
+    }
+}
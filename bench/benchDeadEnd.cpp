@@ -0,0 +1,95 @@
+/**
+ * \file benchDeadEnd.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the dead end check and the playouts and searches it cuts short
+ */
+//Importation
+#include "bench.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include "DeadEnd.h"
+#include "Simulator.h"
+#include "Solver.h"
+#include <vector>
+
+namespace {
+
+//Positions of random playouts of the first deals, every tenth move
+const std::vector<BoardT> &positions() {
+    static std::vector<BoardT> boards;
+    if (!boards.empty())
+        return boards;
+    for (uint64_t deal = 0; deal < 100; deal++) {
+        BoardT board = deal_board(deal);
+        DealRngT random(~deal);
+        MoveT moves[MAX_MOVES];
+        for (unsigned int step = 0; step < 300; step++) {
+            unsigned int n = board.generate_moves(moves);
+            if (n == 0)
+                break;
+            if (step % 10 == 0)
+                boards.push_back(board);
+            board.make(moves[random.bounded(n)]);
+        }
+    }
+    return boards;
+}
+
+//Positions 60 greedy moves into the first deals, small enough to search out
+const std::vector<BoardT> &midgames() {
+    static std::vector<BoardT> boards;
+    SimulatorT greedy(GreedyFoundation, 1, 60, false);
+    for (uint64_t deal = 0; boards.size() < 100; deal++) {
+        BoardT board = deal_board(deal);
+        DealRngT random(~deal);
+        greedy.play(board, random);
+        boards.push_back(board);
+    }
+    return boards;
+}
+
+//Play one playout per op, with or without the dead end check
+void playouts(unsigned long iterations, PolicyT policy, bool prune) {
+    SimulatorT simulator(policy, 1, 1000, prune);
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board = deal_board(i);
+        DealRngT random(~i);
+        bench_keep(simulator.play(board, random));
+    }
+}
+
+}
+
+BENCHMARK("deadend/is_dead_end") {
+    const std::vector<BoardT> &boards = positions();
+    for (unsigned long i = 0; i < iterations; i++) {
+        bool dead = is_dead_end(boards[i % boards.size()]);
+        bench_keep(dead);
+    }
+}
+
+BENCHMARK("deadend/playout, random policy, pruned") {
+    playouts(iterations, RandomPolicy, true);
+}
+
+BENCHMARK("deadend/playout, random policy, full") {
+    playouts(iterations, RandomPolicy, false);
+}
+
+BENCHMARK("deadend/playout, greedy foundation policy, pruned") {
+    playouts(iterations, GreedyFoundation, true);
+}
+
+BENCHMARK("deadend/playout, greedy foundation policy, full") {
+    playouts(iterations, GreedyFoundation, false);
+}
+
+BENCHMARK("deadend/solve midgame, 20000 nodes") {
+    const std::vector<BoardT> &boards = midgames();
+    SolverT solver(20000);
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(solver.solve(boards[i % boards.size()]).status);
+}
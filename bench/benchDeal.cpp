@@ -0,0 +1,24 @@
+/**
+ * \file benchDeal.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the deal generator
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "Deal.h"
+
+BENCHMARK("deal/deal_packed") {
+    PackedCardT packed[TOTAL_CARD];
+    for (unsigned long i = 0; i < iterations; i++) {
+        deal_packed(i, packed);
+        bench_keep(packed);
+    }
+}
+
+BENCHMARK("deal/deal_cards") {
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(deal_cards(i));
+}
@@ -0,0 +1,65 @@
+/**
+ * \file benchDealDatabase.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for streaming through a deal database
+ */
+//Importation
+#include "bench.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include "DealDatabase.h"
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+namespace {
+
+//Number of deals in the database streamed through
+const uint64_t DEALS = 100000;
+
+//Path of a database of DEALS deals, written once
+const std::string &database() {
+    static std::string path;
+    if (path.empty()) {
+        char name[] = "/tmp/benchDealDatabaseXXXXXX";
+        int fd = mkstemp(name);
+        close(fd);
+        path = name;
+        DealDbWriterT writer(path);
+        PackedCardT packed[TOTAL_CARD];
+        for (uint64_t seed = 0; seed < DEALS; seed++) {
+            deal_packed(seed, packed);
+            writer.append(packed, seed);
+        }
+        writer.close();
+        std::atexit([] { std::remove(database().c_str()); });
+    }
+    return path;
+}
+
+}
+
+BENCHMARK("dealdb/stream BoardT from records, unchecked") {
+    DealDbT db(database());
+    bench_reset_timer();
+    uint64_t index = 0;
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board(db.begin()[index].cards, false);
+        bench_keep(board);
+        if (++index == db.size())
+            index = 0;
+    }
+}
+
+BENCHMARK("dealdb/generate BoardT from seeds") {
+    uint64_t seed = 0;
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board = deal_board(seed);
+        bench_keep(board);
+        if (++seed == DEALS)
+            seed = 0;
+    }
+}
@@ -0,0 +1,90 @@
+/**
+ * \file benchMatchKernel.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for each implementation of the top-card matching kernel
+ */
+//Importation
+#include "bench.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "MatchKernel.h"
+#include "Deal.h"
+#include <vector>
+
+namespace {
+
+//Tops of eleven origins and the cards of 32 destinations, as generate_moves builds them
+struct TopsT {
+    PackedCardT origins[TAB_SIZE + 1];
+    PackedCardT accepts[KERNEL_LANES];
+};
+
+TopsT sample_tops() {
+    TopsT tops = {{0}, {0}};
+    DealRngT rng(5);
+    for (int i = 0; i <= TAB_SIZE; i++)
+        tops.origins[i] = 4 + rng.bounded(52);
+    for (int i = 0; i < TAB_SIZE + FOUND_SIZE; i++)
+        tops.accepts[i < TAB_SIZE ? i : 16 + i - TAB_SIZE] = 4 + rng.bounded(52);
+    return tops;
+}
+
+void run_matrix(KernelT kernel, unsigned long iterations) {
+    if (!match_kernel_supported(kernel))
+        return;
+    KernelT previous = match_kernel();
+    set_match_kernel(kernel);
+    TopsT tops = sample_tops();
+    uint32_t rows[TAB_SIZE + 1];
+    for (unsigned long i = 0; i < iterations; i++) {
+        bench_keep(tops);
+        match_matrix(tops.origins, TAB_SIZE + 1, tops.accepts, rows);
+        bench_keep(rows);
+    }
+    set_match_kernel(previous);
+}
+
+void run_generate(KernelT kernel, unsigned long iterations) {
+    if (!match_kernel_supported(kernel))
+        return;
+    KernelT previous = match_kernel();
+    set_match_kernel(kernel);
+    BoardT board = deal_board(3);
+    for (int i = 0; i < 30; i++)
+        board.deck_mv();
+    MoveT moves[MAX_MOVES];
+    for (unsigned long i = 0; i < iterations; i++) {
+        unsigned int n = board.generate_moves(moves);
+        bench_keep(n);
+        bench_keep(moves);
+    }
+    set_match_kernel(previous);
+}
+
+}
+
+BENCHMARK("kernel/match_matrix, scalar") {
+    run_matrix(ScalarKernel, iterations);
+}
+
+BENCHMARK("kernel/match_matrix, sse2") {
+    run_matrix(Sse2Kernel, iterations);
+}
+
+BENCHMARK("kernel/match_matrix, avx2") {
+    run_matrix(Avx2Kernel, iterations);
+}
+
+BENCHMARK("kernel/generate_moves, scalar") {
+    run_generate(ScalarKernel, iterations);
+}
+
+BENCHMARK("kernel/generate_moves, sse2") {
+    run_generate(Sse2Kernel, iterations);
+}
+
+BENCHMARK("kernel/generate_moves, avx2") {
+    run_generate(Avx2Kernel, iterations);
+}
@@ -0,0 +1,94 @@
+/**
+ * \file benchMoveSummary.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the card masks of the move summary against pairwise top comparison
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include <vector>
+
+namespace {
+
+//Positions met in random games once the deck is turned over, so the deck does
+//not answer valid_mv_exists and branches are not always taken the same way
+const std::vector<BoardT> &positions() {
+    static std::vector<BoardT> boards;
+    if (boards.empty()) {
+        MoveT moves[MAX_MOVES];
+        for (uint64_t seed = 0; seed < 16; seed++) {
+            BoardT board = deal_board(seed);
+            DealRngT rng(seed);
+            while (board.is_valid_deck_mv())
+                board.deck_mv();
+            for (int step = 0; step < 64; step++) {
+                boards.push_back(board);
+                unsigned int n = board.generate_moves(moves);
+                if (n == 0)
+                    break;
+                board.make(moves[rng.bounded(n)]);
+            }
+        }
+    }
+    return boards;
+}
+
+//valid_mv_exists as it was before the move summary: every top against every top
+bool pairwise_valid_mv_exists(const BoardT &board) {
+    if (!board.view_deck().empty())
+        return true;
+    PackedCardT tabTop[TAB_SIZE];
+    for (int i = 0; i < TAB_SIZE; i++) {
+        PileViewT tab = board.view_tab(i);
+        tabTop[i] = tab.empty() ? 0 : tab.packed(tab.size() - 1);
+    }
+    PileViewT waste = board.view_waste();
+    for (int i = 0; i <= TAB_SIZE; i++) {
+        PackedCardT card = i < TAB_SIZE ? tabTop[i] : waste.empty() ? 0 : waste.packed(waste.size() - 1);
+        if (card == 0)
+            continue;
+        for (int j = 0; j < TAB_SIZE; j++) {
+            if (j != i && (tabTop[j] == 0 || card + 4 == tabTop[j]))
+                return true;
+        }
+        for (int j = 0; j < FOUND_SIZE; j++) {
+            PileViewT found = board.view_foundation(j);
+            if (found.empty() ? packed_rank(card) == ACE : card == found.packed(found.size() - 1) + 4)
+                return true;
+        }
+    }
+    return false;
+}
+
+}
+
+BENCHMARK("summary/valid_mv_exists, card masks") {
+    std::vector<BoardT> boards = positions();
+    for (unsigned long i = 0; i < iterations; i++) {
+        bool exists = boards[i % boards.size()].valid_mv_exists();
+        bench_keep(exists);
+    }
+}
+
+BENCHMARK("summary/valid_mv_exists, pairwise tops") {
+    const std::vector<BoardT> &boards = positions();
+    for (unsigned long i = 0; i < iterations; i++) {
+        bool exists = pairwise_valid_mv_exists(boards[i % boards.size()]);
+        bench_keep(exists);
+    }
+}
+
+BENCHMARK("summary/generate_moves") {
+    std::vector<BoardT> boards = positions();
+    MoveT moves[MAX_MOVES];
+    for (unsigned long i = 0; i < iterations; i++) {
+        unsigned int n = boards[i % boards.size()].generate_moves(moves);
+        bench_keep(n);
+        bench_keep(moves);
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * \file benchParallelSolver.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Scaling benchmarks for the parallel solver, one op is one search of each of a fixed set of deals
+ * \details Every search stops near the same node budget, but threads check it
+ * only every few nodes, so more threads search somewhat more nodes per op.
+ * Each benchmark therefore reports the nodes searched per op and its speedup
+ * as nodes per second over the 1 thread benchmark, from the fastest op of each.
+ */
+//Importation
+#include "bench.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include "ParallelSolver.h"
+#include <chrono>
+#include <map>
+
+namespace {
+
+//Same fixed deal set and node budget for every thread count
+const unsigned int DEALS = 4;
+const unsigned long long NODE_BUDGET = 25000;
+
+void solve_deals(unsigned int threads, unsigned long iterations) {
+    //Highest nodes per second seen at each thread count
+    static std::map<unsigned int, double> fastest;
+    //A small table, so clearing it per search does not swamp the nodes
+    ParallelSolverT solver(threads, NODE_BUDGET, 1);
+    unsigned long long nodes = 0;
+    bench_reset_timer();
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++) {
+        for (uint64_t deal = 0; deal < DEALS; deal++)
+            nodes += solver.solve(deal_board(deal)).nodes;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    double rate = static_cast<double>(nodes) / elapsed.count();
+    if (fastest.count(threads) == 0 || rate > fastest[threads])
+        fastest[threads] = rate;
+    bench_report("nodes/op", static_cast<double>(nodes) / iterations);
+    bench_report("nodes/s", rate);
+    if (fastest.count(1) != 0)
+        bench_report("speedup", fastest[threads] / fastest[1]);
+}
+
+}
+
+BENCHMARK("parallel solver/1 thread") {
+    solve_deals(1, iterations);
+}
+
+BENCHMARK("parallel solver/2 threads") {
+    solve_deals(2, iterations);
+}
+
+BENCHMARK("parallel solver/4 threads") {
+    solve_deals(4, iterations);
+}
+
+BENCHMARK("parallel solver/8 threads") {
+    solve_deals(8, iterations);
+}
+
+BENCHMARK("parallel solver/16 threads") {
+    solve_deals(16, iterations);
+}
+
+BENCHMARK("parallel solver/64 threads") {
+    solve_deals(64, iterations);
+}
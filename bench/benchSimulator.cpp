@@ -0,0 +1,22 @@
+/**
+ * \file benchSimulator.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the Monte Carlo simulator, one op is one playout on all cores
+ */
+//Importation
+#include "bench.h"
+#include "Simulator.h"
+
+BENCHMARK("simulator/playout, random policy") {
+    SimulatorT simulator(RandomPolicy);
+    bench_reset_timer();
+    bench_keep(simulator.run(iterations, 1).wins);
+}
+
+BENCHMARK("simulator/playout, greedy foundation policy") {
+    SimulatorT simulator(GreedyFoundation);
+    bench_reset_timer();
+    bench_keep(simulator.run(iterations, 1).wins);
+}
@@ -0,0 +1,47 @@
+/**
+ * \file benchSnapshot.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for writing and reading board snapshots
+ */
+//Importation
+#include "bench.h"
+#include "GameBoard.h"
+#include "Snapshot.h"
+#include "Deal.h"
+
+namespace {
+
+BoardT sample_board() {
+    BoardT board = deal_board(1);
+    for (int i = 0; i < 10; i++)
+        board.deck_mv();
+    return board;
+}
+
+}
+
+BENCHMARK("snapshot/write") {
+    BoardT board = sample_board();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardSnapshotT snap = board.snapshot();
+        bench_keep(snap);
+    }
+}
+
+BENCHMARK("snapshot/read, checked") {
+    BoardSnapshotT snap = sample_board().snapshot();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board(snap);
+        bench_keep(board);
+    }
+}
+
+BENCHMARK("snapshot/read, unchecked") {
+    BoardSnapshotT snap = sample_board().snapshot();
+    for (unsigned long i = 0; i < iterations; i++) {
+        BoardT board(snap, false);
+        bench_keep(board);
+    }
+}
@@ -0,0 +1,31 @@
+/**
+ * \file benchSolver.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the solver, one op is one node
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Solver.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+BENCHMARK("solver/node (shuffled deal)") {
+    std::vector<CardT> d;
+    for (RankT rank = ACE; rank <= KING; rank++) {
+        for (unsigned int suit = 0; suit < 4; suit++) {
+            CardT n = {static_cast<SuitT>(suit), rank};
+            d.push_back(n);
+            d.push_back(n);
+        }
+    }
+    std::mt19937 rng(1);
+    std::shuffle(d.begin(), d.end(), rng);
+    SolverT solver(iterations);
+    SolveResultT result = solver.solve(d);
+    bench_keep(result.nodes);
+}
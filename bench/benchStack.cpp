@@ -0,0 +1,104 @@
+/**
+ * \file benchStack.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for the card stacks
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "CardStack.h"
+#include <vector>
+
+namespace {
+
+//A stack of ten cards
+CardStackT sample_stack() {
+    std::vector<CardT> cards;
+    for (RankT rank = ACE; rank <= 10; rank++) {
+        CardT c = {Heart, rank};
+        cards.push_back(c);
+    }
+    return CardStackT(cards);
+}
+
+}
+
+BENCHMARK("stack/Stack push") {
+    CardStackT stack = sample_stack();
+    CardT card = {Spade, KING};
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.push(card));
+}
+
+BENCHMARK("stack/Stack pop") {
+    CardStackT stack = sample_stack();
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.pop());
+}
+
+BENCHMARK("stack/Stack top") {
+    CardStackT stack = sample_stack();
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.top());
+}
+
+BENCHMARK("stack/Stack toSeq") {
+    CardStackT stack = sample_stack();
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.toSeq());
+}
+
+BENCHMARK("stack/Stack push_inplace+pop_inplace") {
+    CardStackT stack = sample_stack();
+    CardT card = {Spade, KING};
+    for (unsigned long i = 0; i < iterations; i++) {
+        stack.push_inplace(card);
+        stack.pop_inplace();
+        bench_keep(stack);
+    }
+}
+
+BENCHMARK("stack/FixedStack push") {
+    TabStackT stack;
+    for (PackedCardT card = 4; card < 44; card += 4)
+        stack.push_inplace(card);
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.push(52));
+}
+
+BENCHMARK("stack/FixedStack pop") {
+    TabStackT stack;
+    for (PackedCardT card = 4; card < 44; card += 4)
+        stack.push_inplace(card);
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.pop());
+}
+
+BENCHMARK("stack/FixedStack top") {
+    TabStackT stack;
+    for (PackedCardT card = 4; card < 44; card += 4)
+        stack.push_inplace(card);
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.top());
+}
+
+BENCHMARK("stack/FixedStack toSeq") {
+    TabStackT stack;
+    for (PackedCardT card = 4; card < 44; card += 4)
+        stack.push_inplace(card);
+    for (unsigned long i = 0; i < iterations; i++)
+        bench_keep(stack.toSeq());
+}
+
+BENCHMARK("stack/FixedStack push_inplace+pop_inplace") {
+    TabStackT stack;
+    for (PackedCardT card = 4; card < 44; card += 4)
+        stack.push_inplace(card);
+    for (unsigned long i = 0; i < iterations; i++) {
+        stack.push_inplace(52);
+        stack.pop_inplace();
+        bench_keep(stack);
+    }
+}
@@ -0,0 +1,88 @@
+/**
+ * \file benchTransTable.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Throughput benchmarks for the transposition table, one op is a store and a probe
+ * \details Each probe looks up a key the same thread stored RECENT ops before, so
+ * the hit path is measured, and the hit rate is reported. The threads are
+ * started before the timer and wait for a start signal.
+ */
+//Importation
+#include "bench.h"
+#include "MoveTypes.h"
+#include "TransTable.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+namespace {
+
+//Number of ops between storing a key and probing it
+const unsigned int RECENT = 64;
+
+TransTableT &shared_table() {
+    static TransTableT table(64);
+    return table;
+}
+
+void store_and_probe(unsigned int threads, unsigned long iterations) {
+    TransTableT &table = shared_table();
+    std::atomic<unsigned int> ready(0);
+    std::atomic<bool> go(false);
+    std::atomic<unsigned long> hits(0);
+    std::atomic<unsigned long> probes(0);
+    std::vector<std::thread> pool;
+    for (unsigned int t = 0; t < threads; t++) {
+        pool.push_back(std::thread([&, t]() {
+            uint64_t key = 0x9E3779B97F4A7C15ULL * (t + 1);
+            uint64_t recent[RECENT] = {0};
+            TransEntryT entry = {1, ExactBound, 0, MoveT()};
+            TransEntryT found;
+            unsigned long hit = 0;
+            unsigned long probed = 0;
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (unsigned long i = t; i < iterations; i += threads) {
+                key ^= key << 13;
+                key ^= key >> 7;
+                key ^= key << 17;
+                table.store(key, entry);
+                uint64_t &old = recent[probed % RECENT];
+                hit += table.probe(old, found);
+                old = key;
+                probed++;
+            }
+            hits.fetch_add(hit);
+            probes.fetch_add(probed);
+        }));
+    }
+    while (ready.load() < threads)
+        std::this_thread::yield();
+    bench_reset_timer();
+    go.store(true, std::memory_order_release);
+    for (unsigned int t = 0; t < threads; t++)
+        pool[t].join();
+    if (probes.load() > 0)
+        bench_report("hit rate", static_cast<double>(hits.load()) / probes.load());
+}
+
+}
+
+BENCHMARK("trans table/store+probe, 1 thread") {
+    store_and_probe(1, iterations);
+}
+
+BENCHMARK("trans table/store+probe, 4 threads") {
+    store_and_probe(4, iterations);
+}
+
+BENCHMARK("trans table/store+probe, 16 threads") {
+    store_and_probe(16, iterations);
+}
+
+BENCHMARK("trans table/store+probe, 64 threads") {
+    store_and_probe(64, iterations);
+}
@@ -0,0 +1,82 @@
+/**
+ * \file benchView.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Benchmarks for reading every pile of a board
+ */
+//Importation
+#include "bench.h"
+#include "CardTypes.h"
+#include "CardStack.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include <vector>
+
+namespace {
+
+BoardT sample_board() {
+    BoardT board = deal_board(1);
+    for (int i = 0; i < 10; i++)
+        board.deck_mv();
+    return board;
+}
+
+//Sums every card the way a renderer would walk them
+unsigned int render_copies(BoardT &board) {
+    unsigned int sum = 0;
+    std::vector<CardT> cards;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        cards = board.get_tab(i).toSeq();
+        for (unsigned int j = 0; j < cards.size(); j++)
+            sum += cards[j].r + cards[j].s;
+    }
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        cards = board.get_foundation(i).toSeq();
+        for (unsigned int j = 0; j < cards.size(); j++)
+            sum += cards[j].r + cards[j].s;
+    }
+    cards = board.get_deck().toSeq();
+    for (unsigned int j = 0; j < cards.size(); j++)
+        sum += cards[j].r + cards[j].s;
+    cards = board.get_waste().toSeq();
+    for (unsigned int j = 0; j < cards.size(); j++)
+        sum += cards[j].r + cards[j].s;
+    return sum;
+}
+
+unsigned int render_view(PileViewT view) {
+    unsigned int sum = 0;
+    for (unsigned int j = 0; j < view.size(); j++)
+        sum += view[j].r + view[j].s;
+    return sum;
+}
+
+unsigned int render_views(const BoardT &board) {
+    unsigned int sum = 0;
+    for (int i = 0; i < TAB_SIZE; i++)
+        sum += render_view(board.view_tab(i));
+    for (int i = 0; i < FOUND_SIZE; i++)
+        sum += render_view(board.view_foundation(i));
+    sum += render_view(board.view_deck());
+    sum += render_view(board.view_waste());
+    return sum;
+}
+
+}
+
+BENCHMARK("view/render with get_* and toSeq") {
+    BoardT board = sample_board();
+    for (unsigned long i = 0; i < iterations; i++) {
+        unsigned int sum = render_copies(board);
+        bench_keep(sum);
+    }
+}
+
+BENCHMARK("view/render with view_*") {
+    BoardT board = sample_board();
+    for (unsigned long i = 0; i < iterations; i++) {
+        unsigned int sum = render_views(board);
+        bench_keep(sum);
+    }
+}
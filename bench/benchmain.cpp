@@ -0,0 +1,229 @@
+/**
+ * \file benchmain.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Runs every registered benchmark and reports ns/op and allocations/op
+ * \details Usage: bench [--csv|--json] [--reps N] [--min-time SECONDS] [FILTER].
+ * Each benchmark is run once untimed, calibrated until one repetition takes at least the minimum
+ * time, run once more as a warmup, then run N times. A benchmark still under
+ * the minimum time at 2^30 iterations is reported as an error. The median, 99th
+ * percentile (nearest rank) and minimum of ns/op over the repetitions are
+ * reported with the allocations and bytes allocated per op, counted in one
+ * more run with allocation tracking on, and any figures the benchmark reports.
+ */
+//Importation
+#include "bench.h"
+#include "AllocStats.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct BenchCase {
+    const char *name;
+    BenchFn fn;
+};
+
+struct BenchStats {
+    std::vector<std::pair<const char *, double> > reports;
+    unsigned long iterations;
+    unsigned int reps;
+    double median;
+    double p99;
+    double min;
+    double mean;
+    double allocs;
+    double bytes;
+};
+
+enum BenchFormat {Table, Csv, Json};
+
+//Most iterations calibration tries, far more than any body needs to fill the minimum time
+const unsigned long MAX_ITERATIONS = 1UL << 30;
+
+//Start of the measured part of the running benchmark
+std::chrono::steady_clock::time_point timerStart;
+AllocStatsT allocStart;
+//Figures reported by the running benchmark
+std::vector<std::pair<const char *, double> > reports;
+
+std::vector<BenchCase> &registry() {
+    static std::vector<BenchCase> cases;
+    return cases;
+}
+
+//One run of a benchmark: seconds taken, allocations and bytes allocated
+struct BenchRun {
+    double seconds;
+    unsigned long allocs;
+    unsigned long bytes;
+};
+
+BenchRun run(BenchFn fn, unsigned long iterations) {
+    reports.clear();
+    bench_reset_timer();
+    fn(iterations);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - timerStart;
+    AllocStatsT allocEnd = alloc_stats();
+    BenchRun r = {elapsed.count(),
+                  static_cast<unsigned long>(allocEnd.allocations - allocStart.allocations),
+                  static_cast<unsigned long>(allocEnd.bytes - allocStart.bytes)};
+    return r;
+}
+
+//Returns false if a run of MAX_ITERATIONS still takes less than minTime,
+//i.e. the time of the body does not grow with the iterations
+bool measure(BenchFn fn, unsigned int reps, double minTime, BenchStats &stats) {
+    //A first run sets up anything a benchmark builds once, so it is not timed
+    run(fn, 1);
+    //Grow the iteration count until one run takes at least minTime
+    unsigned long iterations = 1;
+    while (run(fn, iterations).seconds < minTime) {
+        if (iterations >= MAX_ITERATIONS)
+            return false;
+        iterations *= 2;
+    }
+    //Warmup
+    run(fn, iterations);
+    std::vector<double> samples(reps);
+    for (unsigned int i = 0; i < reps; i++)
+        samples[i] = run(fn, iterations).seconds * 1e9 / iterations;
+    //Allocations are counted in a run of their own, so counting is not timed
+    set_alloc_tracking(true);
+    BenchRun counted = run(fn, iterations);
+    set_alloc_tracking(false);
+    std::sort(samples.begin(), samples.end());
+    stats.reports = reports;
+    stats.iterations = iterations;
+    stats.reps = reps;
+    stats.median = reps % 2 ? samples[reps / 2] : (samples[reps / 2 - 1] + samples[reps / 2]) / 2;
+    stats.p99 = samples[(reps * 99 + 99) / 100 - 1];
+    stats.min = samples[0];
+    stats.mean = 0;
+    for (unsigned int i = 0; i < reps; i++)
+        stats.mean += samples[i] / reps;
+    stats.allocs = static_cast<double>(counted.allocs) / iterations;
+    stats.bytes = static_cast<double>(counted.bytes) / iterations;
+    return true;
+}
+
+//Quote a name for CSV or JSON
+std::string quoted(const char *name, char escape) {
+    std::string out = "\"";
+    for (const char *c = name; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            out += *c == '"' && escape == '"' ? '"' : '\\';
+        out += *c;
+    }
+    return out + "\"";
+}
+
+void print_header(BenchFormat format) {
+    if (format == Table)
+        std::printf("%-48s %10s %12s %12s %12s %10s %10s\n", "benchmark", "iters/rep",
+                    "median ns", "p99 ns", "min ns", "allocs/op", "bytes/op");
+    else if (format == Csv)
+        std::printf("name,reps,iterations,median_ns,p99_ns,min_ns,mean_ns,allocs_per_op,bytes_per_op,reports\n");
+    else
+        std::printf("[\n");
+}
+
+void print_stats(BenchFormat format, const char *name, const BenchStats &s, bool first) {
+    if (format == Table) {
+        std::printf("%-48s %10lu %12.2f %12.2f %12.2f %10.2f %10.1f", name, s.iterations,
+                    s.median, s.p99, s.min, s.allocs, s.bytes);
+        for (unsigned int i = 0; i < s.reports.size(); i++)
+            std::printf("  %s %.6g", s.reports[i].first, s.reports[i].second);
+        std::printf("\n");
+    } else if (format == Csv) {
+        std::printf("%s,%u,%lu,%.3f,%.3f,%.3f,%.3f,%.4f,%.2f,\"", quoted(name, '"').c_str(), s.reps,
+                    s.iterations, s.median, s.p99, s.min, s.mean, s.allocs, s.bytes);
+        for (unsigned int i = 0; i < s.reports.size(); i++)
+            std::printf("%s%s=%.6g", i ? ";" : "", s.reports[i].first, s.reports[i].second);
+        std::printf("\"\n");
+    } else {
+        std::printf("%s  {\"name\": %s, \"reps\": %u, \"iterations\": %lu, \"median_ns\": %.3f, "
+                    "\"p99_ns\": %.3f, \"min_ns\": %.3f, \"mean_ns\": %.3f, \"allocs_per_op\": %.4f, "
+                    "\"bytes_per_op\": %.2f, \"reports\": {", first ? "" : ",\n", quoted(name, '\\').c_str(), s.reps,
+                    s.iterations, s.median, s.p99, s.min, s.mean, s.allocs, s.bytes);
+        for (unsigned int i = 0; i < s.reports.size(); i++)
+            std::printf("%s%s: %.6g", i ? ", " : "", quoted(s.reports[i].first, '\\').c_str(), s.reports[i].second);
+        std::printf("}}");
+    }
+    std::fflush(stdout);
+}
+
+}
+
+void bench_reset_timer() {
+    allocStart = alloc_stats();
+    timerStart = std::chrono::steady_clock::now();
+}
+
+void bench_report(const char *name, double value) {
+    for (unsigned int i = 0; i < reports.size(); i++) {
+        if (std::strcmp(reports[i].first, name) == 0) {
+            reports[i].second = value;
+            return;
+        }
+    }
+    reports.push_back(std::make_pair(name, value));
+}
+
+BenchRegistrar::BenchRegistrar(const char *name, BenchFn fn) {
+    BenchCase c = {name, fn};
+    registry().push_back(c);
+}
+
+/**
+ * \brief Runs the benchmarks whose name contains FILTER, or all of them
+ */
+int main(int argc, char **argv) {
+    BenchFormat format = Table;
+    unsigned int reps = 15;
+    double minTime = 0.02;
+    const char *filter = "";
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            format = Csv;
+        } else if (std::strcmp(argv[i], "--json") == 0) {
+            format = Json;
+        } else if (std::strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            minTime = std::atof(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            std::fprintf(stderr, "usage: %s [--csv|--json] [--reps N] [--min-time SECONDS] [FILTER]\n", argv[0]);
+            return 2;
+        } else {
+            filter = argv[i];
+        }
+    }
+    print_header(format);
+    bool first = true;
+    bool failed = false;
+    for (unsigned int i = 0; i < registry().size(); i++) {
+        BenchCase &c = registry()[i];
+        if (std::strstr(c.name, filter) == NULL)
+            continue;
+        BenchStats stats;
+        if (!measure(c.fn, reps, minTime, stats)) {
+            std::fprintf(stderr, "%s: %lu iterations take under %g s, the body does not use 'iterations'\n",
+                         c.name, MAX_ITERATIONS, minTime);
+            failed = true;
+            continue;
+        }
+        print_stats(format, c.name, stats, first);
+        first = false;
+    }
+    if (format == Json)
+        std::printf("\n]\n");
+    return failed ? 1 : 0;
+}
@@ -6,12 +6,12 @@
  *
  * This file will not be graded
  */
-#include <algorithm>
 #include <iostream>
 #include <vector>
 
 #include "CardStack.h"
 #include "CardTypes.h"
+#include "Deal.h"
 #include "GameBoard.h"
 #include "Stack.h"
 
@@ -25,16 +25,8 @@ int main() {
 
 
   // Produce a new deck (consisting of two standard decks) and shuffle its
-  // cards.
-  std::vector<CardT> d;
-  for (RankT rank = ACE; rank <= KING; rank++) {
-    for (unsigned int suit = 0; suit < 4; suit++) {
-      CardT n = { static_cast<SuitT>(suit), rank };
-      d.push_back(n);
-      d.push_back(n);
-    }
-  }
-  std::random_shuffle(d.begin(), d.end());
+  // cards. Deal numbers give the same deal on every platform.
+  std::vector<CardT> d = deal_cards(1);
 
   BoardT board(d);
   try {
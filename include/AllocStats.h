@@ -0,0 +1,90 @@
+/**
+ * \file AllocStats.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines opt-in counting of the heap allocations made by the engine
+ * \details Implemented in alloc/AllocStats.cpp, which only the tests and
+ * benchmarks link; programs built from src alone keep the standard allocator.
+ */
+#ifndef A3_ALLOC_STATS_H_
+#define A3_ALLOC_STATS_H_
+
+/**
+ * \brief Counts of heap allocations made through operator new and delete
+ * \details Only allocations made while tracking is on are counted. Live bytes
+ * are bytes allocated minus bytes freed, counting the bytes asked for, so a
+ * difference of two counts can be negative.
+ */
+struct AllocStatsT {
+    /**
+     * \brief Number of calls to operator new
+     */
+    long long allocations;
+    /**
+     * \brief Number of calls to operator delete with a non-null pointer
+     */
+    long long frees;
+    /**
+     * \brief Bytes asked for from operator new
+     */
+    long long bytes;
+    /**
+     * \brief Bytes asked for by the blocks allocated and not yet freed
+     */
+    long long liveBytes;
+};
+
+/**
+ * \brief Turn the counting of allocations on or off
+ * \details Off by default. The counters are shared by every thread; when off,
+ * operator new and delete cost one relaxed load more than malloc and free.
+ * \param enabled True to count allocations, false to stop
+ */
+void set_alloc_tracking(bool enabled);
+
+/**
+ * \brief Check if allocations are being counted
+ * \return True if counting, false otherwise
+ */
+bool alloc_tracking();
+
+/**
+ * \brief Returns the counts since the program started
+ * \return The counts
+ */
+AllocStatsT alloc_stats();
+
+/**
+ * \brief Counts the allocations made during a scope, e.g. one engine operation
+ * \details Turns tracking on while it lives and restores the previous setting
+ * when destroyed. Scopes on different threads see each other's allocations.
+ */
+class AllocScopeT {
+    private:
+        AllocStatsT start;
+        bool previous;
+        AllocScopeT(const AllocScopeT &);
+        AllocScopeT &operator=(const AllocScopeT &);
+    public:
+        /**
+         * \brief Constructor method for the class, starts counting
+         */
+        AllocScopeT();
+        /**
+         * \brief Destructor method for the class, restores the tracking setting
+         */
+        ~AllocScopeT();
+        /**
+         * \brief Returns the counts since the scope started
+         * \return The counts
+         */
+        AllocStatsT stats() const;
+        /**
+         * \brief Returns the number of allocations since the scope started
+         * \return The number of allocations
+         */
+        long long allocations() const;
+};
+
+#endif
@@ -2,8 +2,8 @@
  * \file CardStack.h
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/09
- * \date Last modified 2019/03/09
- * \brief Defines a specific version of the generic stack template with the class CardT
+ * \date Last modified 2026/10/17
+ * \brief Defines specific versions of the generic stack templates for cards
  */
 #ifndef A3_CARD_STACK_H_
 #define A3_CARD_STACK_H_
@@ -11,10 +11,42 @@
 //Importation
 #include "CardTypes.h"
 #include "Stack.h"
+#include "FixedStack.h"
+
+/**
+ * \brief Most cards a tableau pile can hold.
+ * \details Four dealt cards plus a same-suit run below the top one.
+ */
+#define TAB_CAPACITY 16
+
+/**
+ * \brief Most cards a foundation can hold.
+ */
+#define FOUND_CAPACITY 13
+
+/**
+ * \brief Most cards the deck or the waste can hold.
+ */
+#define PILE_CAPACITY 64
 
 /**
  * \brief Defines a specific version of the generic stack template with the class CardT
  */
 typedef Stack<CardT> CardStackT;
 
+/**
+ * \brief Inline packed card stack sized for a tableau pile
+ */
+typedef FixedStack<PackedCardT, TAB_CAPACITY> TabStackT;
+
+/**
+ * \brief Inline packed card stack sized for a foundation
+ */
+typedef FixedStack<PackedCardT, FOUND_CAPACITY> FoundStackT;
+
+/**
+ * \brief Inline packed card stack sized for the deck or the waste
+ */
+typedef FixedStack<PackedCardT, PILE_CAPACITY> PileStackT;
+
 #endif
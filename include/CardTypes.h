@@ -2,7 +2,7 @@
  * \file CardTypes.h
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/09
- * \date Last modified 2019/03/17
+ * \date Last modified 2026/10/17
  * \brief Defines the type of the card
  */
 #ifndef A3_CARD_TYPES_H_
@@ -62,4 +62,50 @@ struct CardT {
     RankT r;
 };
 
+/**
+ * \brief Describes a card packed into one byte
+ * \details The rank is stored in bits 2-5 and the suit in bits 0-1, so the
+ * value is (r << 2) | s. Zero is never a valid card. A card can be placed on
+ * a tableau card whose packed value is exactly 4 larger, and on a foundation
+ * card whose packed value is exactly 4 smaller.
+ */
+typedef unsigned char PackedCardT;
+
+/**
+ * \brief Packs a card into one byte
+ * \param card The card being packed
+ * \return The packed card
+ */
+inline PackedCardT pack_card(CardT card) {
+    return static_cast<PackedCardT>((card.r << 2) | card.s);
+}
+
+/**
+ * \brief Unpacks a card packed by pack_card
+ * \param card The packed card
+ * \return The card as a tuple of suit and rank
+ */
+inline CardT unpack_card(PackedCardT card) {
+    CardT c = {static_cast<SuitT>(card & 3), static_cast<RankT>(card >> 2)};
+    return c;
+}
+
+/**
+ * \brief Returns the suit of a packed card
+ * \param card The packed card
+ * \return Suit of the card
+ */
+inline SuitT packed_suit(PackedCardT card) {
+    return static_cast<SuitT>(card & 3);
+}
+
+/**
+ * \brief Returns the rank of a packed card
+ * \param card The packed card
+ * \return Rank of the card
+ */
+inline RankT packed_rank(PackedCardT card) {
+    return card >> 2;
+}
+
 #endif
@@ -0,0 +1,29 @@
+/**
+ * \file DeadEnd.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a static check for positions that can no longer be won
+ */
+#ifndef A3_DEAD_END_H_
+#define A3_DEAD_END_H_
+
+//Importation
+#include "GameBoard.h"
+
+/**
+ * \brief Check if a position is provably lost
+ * \details Finds, as a least fixpoint, every card that could ever leave its
+ * pile, every card that could ever reach a foundation and every card that could
+ * ever lie on top of a tableau, assuming no tableau is ever empty. Each fact is
+ * only derived once the facts any real move would need are, so a card not found
+ * to leave never does. If no tableau can be cleared that way, none ever will be,
+ * so the game cannot be won: e.g. when both copies of a card are buried under
+ * cards that wait for it. Runs on the piles in place, allocates nothing and
+ * never reports a winnable position as lost.
+ * \param board The position
+ * \return True if the game cannot be won from the position, false if it may be
+ */
+bool is_dead_end(const BoardT &board);
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * \file Deal.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a seeded, platform-independent deal generator
+ */
+#ifndef A3_DEAL_H_
+#define A3_DEAL_H_
+
+//Importation
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include <vector>
+#include <stdint.h>
+
+/**
+ * \brief xoshiro256** random number generator seeded through splitmix64
+ * \details Both algorithms are fully specified, so a seed gives the same
+ * numbers on every compiler and platform, unlike the std distributions.
+ */
+class DealRngT {
+    private:
+        uint64_t state[4];
+    public:
+        /**
+         * \brief Type of the numbers returned, so the class works as a std generator
+         */
+        typedef uint64_t result_type;
+        /**
+         * \brief Constructor method for the class
+         * \param seed The seed, expanded into the state with splitmix64
+         */
+        DealRngT(uint64_t seed);
+        /**
+         * \brief Returns the next 64-bit number
+         * \return The number
+         */
+        uint64_t next();
+        /**
+         * \brief Returns a number in [0, bound)
+         * \details Takes the high 32 bits of next() and multiplies by bound,
+         * keeping the high 32 bits of the product. The bias is below 2^-24
+         * for the bounds a deal uses.
+         * \param bound Upper bound, at most 2^32
+         * \return The number
+         */
+        uint32_t bounded(uint32_t bound);
+        /**
+         * \brief Returns the next 64-bit number, so the class works as a std generator
+         * \return The number
+         */
+        uint64_t operator()() {
+            return next();
+        }
+        /**
+         * \brief Smallest value returned by operator()
+         * \return 0
+         */
+        static constexpr uint64_t min() {
+            return 0;
+        }
+        /**
+         * \brief Largest value returned by operator()
+         * \return 2^64 - 1
+         */
+        static constexpr uint64_t max() {
+            return ~(uint64_t)0;
+        }
+};
+
+/**
+ * \brief Deal number seed as packed cards
+ * \details Starts from two decks ordered by rank, then suit, each card twice,
+ * and shuffles them with Fisher-Yates from the last card down, using
+ * DealRngT(seed).bounded(i + 1) for position i.
+ * \param seed Number of the deal
+ * \param out Buffer of TOTAL_CARD packed cards the deal is written to
+ */
+void deal_packed(uint64_t seed, PackedCardT *out);
+
+/**
+ * \brief Deal number seed as a sequence of cards, ready for the BoardT constructor
+ * \param seed Number of the deal
+ * \return Sequence of TOTAL_CARD cards
+ */
+std::vector<CardT> deal_cards(uint64_t seed);
+
+/**
+ * \brief Deal number seed straight onto a board
+ * \details The deal is known to be two decks, so the board skips that check.
+ * \param seed Number of the deal
+ * \return The board of the deal
+ */
+BoardT deal_board(uint64_t seed);
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * \file DealDatabase.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a memory-mapped database of deals and their solve results
+ */
+#ifndef A3_DEAL_DATABASE_H_
+#define A3_DEAL_DATABASE_H_
+
+//Importation
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Solver.h"
+#include <string>
+#include <cstdio>
+#include <stdint.h>
+
+/**
+ * \brief Version of the deal database format written by this build
+ */
+#define DEAL_DB_VERSION 1
+
+/**
+ * \brief Header at the start of a deal database file
+ * \details Integers are stored in the byte order of the machine that wrote the
+ * file; byteOrder lets a reader refuse a file written with the other one.
+ */
+struct DealDbHeaderT {
+    /**
+     * \brief The bytes 'B', 'D', 'D', 'B'
+     */
+    unsigned char magic[4];
+    /**
+     * \brief Version of the format, DEAL_DB_VERSION
+     */
+    uint32_t version;
+    /**
+     * \brief The value 0x01020304 as written by the machine
+     */
+    uint32_t byteOrder;
+    /**
+     * \brief Size of a record in bytes, sizeof(DealRecordT)
+     */
+    uint32_t stride;
+    /**
+     * \brief Number of records following the header
+     */
+    uint64_t count;
+    /**
+     * \brief Unused, zero; pads the header so records stay 64-byte aligned
+     */
+    unsigned char reserved[40];
+};
+
+/**
+ * \brief Record of one deal and the result of solving it
+ * \details Records are 128 bytes following a 64-byte header, so record i lies
+ * at a fixed offset in the file and spans exactly two cache lines.
+ */
+struct DealRecordT {
+    /**
+     * \brief Packed cards of the deal, as given to BoardT(const PackedCardT*, bool)
+     */
+    PackedCardT cards[TOTAL_CARD];
+    /**
+     * \brief Seed the deal was generated from, or 0 if it was not
+     */
+    uint64_t seed;
+    /**
+     * \brief Number of moves made by the search that solved the deal
+     */
+    uint64_t nodes;
+    /**
+     * \brief Length of the winning sequence of moves, 0 unless Solved
+     */
+    uint32_t moves;
+    /**
+     * \brief Outcome of the search (a SolveStatusT), Unknown until solved
+     */
+    unsigned char status;
+    /**
+     * \brief Unused, zero
+     */
+    unsigned char reserved[3];
+};
+
+/**
+ * \brief Writer appending deals to a new deal database file
+ * \details Records are buffered by stdio and the header is written again
+ * with the final count when the file is closed.
+ */
+class DealDbWriterT {
+    private:
+        std::FILE *file;
+        uint64_t count;
+        void write_header();
+        DealDbWriterT(const DealDbWriterT &);
+        DealDbWriterT &operator=(const DealDbWriterT &);
+    public:
+        /**
+         * \brief Constructor method for the class
+         * \details Creates the file, replacing any file of the same name.
+         * \param path Path of the file
+         * \throws runtime_error The file cannot be created
+         */
+        DealDbWriterT(const std::string &path);
+        /**
+         * \brief Destructor method for the class, closes the file
+         */
+        ~DealDbWriterT();
+        /**
+         * \brief Append a deal with no result yet
+         * \param cards Sequence of TOTAL_CARD packed cards
+         * \param seed Seed the deal was generated from, or 0
+         * \return Index of the record
+         * \throws runtime_error The record cannot be written
+         */
+        uint64_t append(const PackedCardT *cards, uint64_t seed = 0);
+        /**
+         * \brief Append a complete record
+         * \param record The record
+         * \return Index of the record
+         * \throws runtime_error The record cannot be written
+         */
+        uint64_t append(const DealRecordT &record);
+        /**
+         * \brief Write the final header and close the file
+         * \details Called by the destructor if not called before.
+         * \throws runtime_error The file cannot be written
+         */
+        void close();
+};
+
+/**
+ * \brief Memory-mapped view of a deal database file
+ * \details Records are read straight from the mapping, so nothing is parsed and
+ * processes mapping the same file share its pages. A writable database maps the
+ * file shared, so results set by one process are seen by the others.
+ */
+class DealDbT {
+    private:
+        void *mapping;
+        uint64_t length;
+        DealRecordT *records;
+        uint64_t count;
+        bool writable;
+        DealDbT(const DealDbT &);
+        DealDbT &operator=(const DealDbT &);
+    public:
+        /**
+         * \brief Constructor method for the class
+         * \param path Path of a file written by DealDbWriterT
+         * \param writable Whether results can be set
+         * \throws runtime_error The file cannot be opened or mapped
+         * \throws invalid_argument The file is not a deal database of this version and byte order
+         */
+        DealDbT(const std::string &path, bool writable = false);
+        /**
+         * \brief Destructor method for the class, unmaps the file
+         */
+        ~DealDbT();
+        /**
+         * \brief Returns the number of deals
+         * \return The number of deals
+         */
+        uint64_t size() const;
+        /**
+         * \brief Returns one of the records without copying it
+         * \param index Index of the record
+         * \return Reference into the mapping
+         * \throws out_of_range Invalid index
+         */
+        const DealRecordT &record(uint64_t index) const;
+        /**
+         * \brief Returns the first of the records, for streaming through them
+         * \return Pointer into the mapping
+         */
+        const DealRecordT *begin() const;
+        /**
+         * \brief Returns one past the last of the records
+         * \return Pointer into the mapping
+         */
+        const DealRecordT *end() const;
+        /**
+         * \brief Construct the start position of one of the deals
+         * \details The board is filled straight from the packed cards of the record.
+         * \param index Index of the record
+         * \param check Whether to check that the cards are exactly two deck
+         * \return The start position
+         * \throws out_of_range Invalid index
+         * \throws invalid_argument A byte of the record is not a card, or check is set and the cards are not exactly two deck
+         */
+        BoardT board(uint64_t index, bool check = true) const;
+        /**
+         * \brief Record the result of solving one of the deals
+         * \param index Index of the record
+         * \param result The result
+         * \throws out_of_range Invalid index
+         * \throws logic_error The database was not opened writable
+         */
+        void set_result(uint64_t index, const SolveResultT &result);
+};
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * \file FixedStack.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a generic stack with a compile-time capacity
+ */
+#ifndef A3_FIXED_STACK_H_
+#define A3_FIXED_STACK_H_
+
+//Importation
+#include <vector>
+
+/**
+ * \brief Generic template/class representing a stack of at most N elements.
+ * \details Elements are stored inline, so the object owns no heap storage and
+ * can be copied with memcpy. Unused slots are kept value-initialized, which
+ * makes two stacks with the same content bitwise equal.
+ */
+template <class T, unsigned int N>
+class FixedStack {
+    private:
+        T stack[N];
+        unsigned char length;
+    public:
+        /**
+         * \brief Default constructor for the class
+         */
+        FixedStack();
+        /**
+         * \brief Constructor method for the class.
+         * \details Set up with the given list of element
+         * \param stack Initial list of element in the stack
+         * \throw out_of_range out of range exception when the list is longer than N
+         */
+        FixedStack(std::vector<T> stack);
+        /**
+         * \brief Add a element to the top of stack.
+         * \param element Element being added
+         * \return A new FixedStack object with given element on top
+         * \throw out_of_range out of range exception when stack is full
+         */
+        FixedStack<T, N> push(T element);
+        /**
+         * \brief Remove a element from the top of stack.
+         * \return A new FixedStack object without the top-most element
+         * \throw out_of_range out of range exception when stack is empty
+         */
+        FixedStack<T, N> pop();
+        /**
+         * \brief Returns the element on the top of stack
+         * \return The element on the top of stack
+         * \throw out_of_range out of range exception when stack is empty
+         */
+        T top();
+        /**
+         * \brief Returns the size of the stack
+         * \return The size of the stack
+         */
+        unsigned int size() const;
+        /**
+         * \brief Returns the sequence of element in the stack
+         * \return Sequence of element in the stack
+         */
+        std::vector<T> toSeq();
+        /**
+         * \brief Add a element to the top of this stack in place.
+         * \param element Element being added
+         * \throw out_of_range out of range exception when stack is full
+         */
+        void push_inplace(T element);
+        /**
+         * \brief Remove the top-most element of this stack in place.
+         * \throw out_of_range out of range exception when stack is empty
+         */
+        void pop_inplace();
+        /**
+         * \brief Returns a reference to the element on the top of stack
+         * \details The reference is invalidated by the next push_inplace or pop_inplace.
+         * \return Reference to the element on the top of stack
+         * \throw out_of_range out of range exception when stack is empty
+         */
+        const T &top_ref();
+        /**
+         * \brief Replace the content of this stack in place
+         * \param elements First of the elements, bottom-most first
+         * \param count Number of elements
+         * \throw out_of_range out of range exception when count is bigger than N
+         */
+        void assign(const T *elements, unsigned int count);
+        /**
+         * \brief Returns the elements of the stack without copying them
+         * \details The pointer stays valid for the life of the stack, but the
+         * elements past size() are unused.
+         * \return Pointer to the bottom-most element
+         */
+        const T *data() const;
+};
+
+#endif
@@ -2,7 +2,7 @@
  * \file GameBoard.h
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/09
- * \date Last modified 2019/03/25
+ * \date Last modified 2026/10/17
  * \brief Defines the gameboard class for the game
  */
 #ifndef A3_GAME_BOARD_H_
@@ -11,7 +11,11 @@
 //Importation
 #include "CardTypes.h"
 #include "CardStack.h"
+#include "MoveTypes.h"
+#include "PileView.h"
+#include "Snapshot.h"
 #include <vector>
+#include <stdint.h>
 
 //Define constant and type
 /**
@@ -22,6 +26,28 @@
  * \brief Size of foundation
  */
 #define FOUND_SIZE 8
+/**
+ * \brief Most legal moves a position can have
+ * \details Every tableau to every tableau or foundation, the waste to every
+ * tableau or foundation, and the deck to the waste.
+ */
+#define MAX_MOVES (TAB_SIZE * (TAB_SIZE + FOUND_SIZE) + TAB_SIZE + FOUND_SIZE + 1)
+/**
+ * \brief Size of the per-card tables of the move summary, indexed by packed card
+ * \details At most 64, so a set of cards fits in the bits of a uint64_t.
+ */
+#define SUMMARY_SIZE 60
+/**
+ * \brief Bits of the count of tableau and waste tops equal to a card
+ * \details A card is exposed by at most its two copies.
+ */
+#define EXPOSED_BITS 2
+/**
+ * \brief Bits of the count of tableau and foundation tops a card can be placed on
+ * \details At most two tableau tops, two foundation tops and, for an ace,
+ * every empty foundation.
+ */
+#define WANTED_BITS 4
 /**
  * \brief Defines the type of an natural number
  */
@@ -29,16 +55,53 @@ typedef unsigned int naturalNumber;
 
 /**
  * \brief The gameboard class for the game
+ * \details All piles are stored inline as packed cards, so a board is one
+ * contiguous, trivially copyable object.
  */
 class BoardT {
     private:
-        CardStackT tableau[TAB_SIZE];
-        CardStackT foundation[FOUND_SIZE];
-        CardStackT deck;
-        CardStackT waste;
+        uint64_t zobrist;
+        //Hash of the position that does not depend on the order of the piles
+        uint64_t canon;
+        TabStackT tableau[TAB_SIZE];
+        FoundStackT foundation[FOUND_SIZE];
+        PileStackT deck;
+        PileStackT waste;
+        //Move summary: how many tableau/waste tops equal each card, how many
+        //tableau/foundation tops each card can be placed on, and the same as
+        //bitmasks indexed by packed card holding the cards counted at least once.
+        //Counts are bit-sliced: bit k of the count of card c is bit c of slice k
+        uint64_t exposedMask;
+        uint64_t wantedMask;
+        uint64_t exposed[EXPOSED_BITS];
+        uint64_t wanted[WANTED_BITS];
+        unsigned char emptyTabs;
+        unsigned char kings;
+        //Number of cards on the two foundations of each suit, 0 for a missing one
+        unsigned char suitHeights[4][2];
+        //Hash of the cards of each tableau, then of each foundation, whatever its place
+        uint64_t pileHashes[TAB_SIZE + FOUND_SIZE];
         bool is_valid_pos(CategoryT category, naturalNumber number);
-        bool tab_placeable(CardT card1, CardT card2);
-        bool foundation_placeable(CardT card1, CardT card2);
+        PackedCardT lift_tab(naturalNumber number);
+        void drop_tab(naturalNumber number, PackedCardT card);
+        PackedCardT lift_foundation(naturalNumber number);
+        void drop_foundation(naturalNumber number, PackedCardT card);
+        PackedCardT lift_deck();
+        void drop_deck(PackedCardT card);
+        PackedCardT lift_waste();
+        void drop_waste(PackedCardT card);
+        void deal(const PackedCardT *cards);
+        uint64_t compute_hash() const;
+        void init_canonical();
+        void pile_changed(naturalNumber pile, uint64_t key);
+        void init_summary();
+        void expose(PackedCardT card, int delta);
+        void want(PackedCardT card, int delta);
+        void tab_top_changed(naturalNumber number, int delta);
+        void found_top_changed(naturalNumber number, int delta);
+        void waste_top_changed(int delta);
+        bool tab_placeable(PackedCardT card1, PackedCardT card2);
+        bool foundation_placeable(PackedCardT card1, PackedCardT card2);
     public:
         /**
          * \brief Default constructor method for the class
@@ -50,7 +113,31 @@ class BoardT {
          * \param cards Sequence of cards
          * \throws invalid_argument invalid argument exception when the cards given is not exactly two deck.
          */
-        BoardT(std::vector<CardT> cards);
+        BoardT(const std::vector<CardT> &cards);
+        /**
+         * \brief Constructor method of the class from packed cards.
+         * \details First 40 cards goes into the tableau, the rest of cards goes to deck.
+         * Cards are dealt straight into the piles with no intermediate copies.
+         * The bytes are always checked to be cards, check adds the count of each card.
+         * \param cards Sequence of TOTAL_CARD packed cards
+         * \param check Whether to check that the cards are exactly two deck
+         * \throws invalid_argument invalid argument exception when a byte is not a card, or when check
+         * is set and the cards given is not exactly two deck.
+         */
+        BoardT(const PackedCardT *cards, bool check = true);
+        /**
+         * \brief Constructor method of the class from a snapshot.
+         * \details The piles are filled straight from the packed cards of the snapshot.
+         * The header, the pile lengths and that every byte is a card are always
+         * checked. Unless check or rehash is set, the hash stored in the snapshot is trusted.
+         * \param snapshot Snapshot written by snapshot()
+         * \param check Whether to check the count of each card, that every pile could arise in a game
+         * and the hash of the snapshot
+         * \param rehash Whether to compute the hash from the cards instead of taking the stored one
+         * \throws invalid_argument invalid argument exception when the header, the pile lengths or a
+         * card are not valid, or when check is set and the cards or the hash are not valid.
+         */
+        explicit BoardT(const BoardSnapshotT &snapshot, bool check = true, bool rehash = false);
         /**
          * \brief Check if the move (from the tableau) is valid
          * \param category Category of the destination
@@ -70,8 +157,8 @@ class BoardT {
          */
         bool is_valid_waste_mv(CategoryT category, naturalNumber destination);
         /**
-         * \brief Check if the size of deck is bigger than 0
-         * \return True if bigger, false otherwise
+         * \brief Check if the size of deck is bigger than 0 and the waste is not full
+         * \return True if so, false otherwise
          */
         bool is_valid_deck_mv();
         /**
@@ -94,6 +181,88 @@ class BoardT {
          * \throws invalid_argument Cannot move the card
          */
         void deck_mv();
+        /**
+         * \brief Check if the move (from the tableau) is valid without throwing
+         * \param category Category of the destination
+         * \param origin Place of card being moved
+         * \param destination Place the card is being moved to
+         * \return Legal if valid, BadPosition if a location is not valid, EmptyOrigin
+         * if the tableau is empty, Illegal otherwise, also when the destination is full
+         */
+        MoveStatusT check_tab_mv(CategoryT category, naturalNumber origin, naturalNumber destination) noexcept;
+        /**
+         * \brief Check if the move (from the waste) is valid without throwing
+         * \param category Category of the destination
+         * \param destination Place the card is being moved to
+         * \return Legal if valid, BadPosition if the location is not valid, EmptyOrigin
+         * if the waste is empty, Illegal otherwise, also when the destination is full
+         */
+        MoveStatusT check_waste_mv(CategoryT category, naturalNumber destination) noexcept;
+        /**
+         * \brief Move a card from tableau to tableau or foundation if the move is valid
+         * \param category Category of the destination
+         * \param origin Place of card being moved
+         * \param destination Place the card is being moved to
+         * \return Status of the move as given by check_tab_mv, the move is made only if Legal
+         */
+        MoveStatusT try_tab_mv(CategoryT category, naturalNumber origin, naturalNumber destination) noexcept;
+        /**
+         * \brief Move a card from waste to tableau or foundation if the move is valid
+         * \param category Category of the destination
+         * \param destination Place the card is being moved to
+         * \return Status of the move as given by check_waste_mv, the move is made only if Legal
+         */
+        MoveStatusT try_waste_mv(CategoryT category, naturalNumber destination) noexcept;
+        /**
+         * \brief Move a card from deck to waste if the deck is not empty and the waste not full
+         * \return Legal if the move was made, EmptyOrigin if the deck is empty, Illegal if the waste is full
+         */
+        MoveStatusT try_deck_mv() noexcept;
+        /**
+         * \brief List every valid move of the position
+         * \details Reads each pile's top card once, allocates nothing and throws nothing.
+         * Unless a tableau is empty, only tops in the wanted card mask are tried, and
+         * those are matched against every destination at once by match_matrix.
+         * Tableau moves come first, then waste moves, then the deck move.
+         * \param out Buffer of at least MAX_MOVES moves the valid moves are written to
+         * \return Number of moves written
+         */
+        unsigned int generate_moves(MoveT *out) noexcept;
+        /**
+         * \brief Apply a move without checking it
+         * \details The move must be valid, i.e. is_valid_tab_mv, is_valid_waste_mv
+         * or is_valid_deck_mv holds for it. Runs in O(1) with no allocation.
+         * \param move The move being made
+         */
+        void make(MoveT move);
+        /**
+         * \brief Take back a move made by make, tab_mv, waste_mv or deck_mv
+         * \details The move must be the last one made on the board. The board is
+         * restored bit for bit, hash included.
+         * \param move The move being taken back
+         */
+        void unmake(MoveT move);
+        /**
+         * \brief Check if a move puts a card on a foundation that no tableau can need again
+         * \details A card is only ever needed on a tableau to take the card of its
+         * suit one rank lower, so it is safe once both copies of that card are on
+         * the foundations, i.e. aces always are and any other card is when both
+         * foundations of its suit are at least one rank below it. Playing a safe
+         * move never turns a winnable position into a lost one. Runs in O(1), the
+         * heights of the foundations being kept with the board.
+         * \param move A valid move
+         * \return True if the move is safe, false otherwise
+         */
+        bool is_safe_mv(MoveT move);
+        /**
+         * \brief Play every safe move to the foundations, see is_safe_mv
+         * \details Reads the foundation heights kept with the board, so every
+         * tableau and waste top is checked without validating moves, and goes round
+         * the piles until no top is safe. The moves are made with make and can be
+         * taken back with unmake in reverse order.
+         * \return The moves made, in order
+         */
+        std::vector<MoveT> auto_play_safe();
         /**
          * \brief Return one of the tableaus on the game board
          * \param number The number of the tableau being returned
@@ -101,6 +270,13 @@ class BoardT {
          * \throws invalid_argument Invalid position
          */
         CardStackT get_tab(naturalNumber number);
+        /**
+         * \brief Return the number of cards in one of the tableaus without copying it
+         * \param number The number of the tableau
+         * \return Number of cards in the tableau
+         * \throws out_of_range Invalid position
+         */
+        unsigned int get_tab_size(naturalNumber number);
         /**
          * \brief Return one of the foundations on the game board
          * \param number The number of the foundation being returned
@@ -118,16 +294,85 @@ class BoardT {
          * \return waste
          */
         CardStackT get_waste();
+        /**
+         * \brief Return a read-only view of one of the tableaus without copying it
+         * \details The view is invalidated by the next move made on the board.
+         * \param number The number of the tableau
+         * \return View of the tableau
+         * \throws out_of_range Invalid position
+         */
+        PileViewT view_tab(naturalNumber number) const;
+        /**
+         * \brief Return a read-only view of one of the foundations without copying it
+         * \details The view is invalidated by the next move made on the board.
+         * \param number The number of the foundation
+         * \return View of the foundation
+         * \throws out_of_range Invalid position
+         */
+        PileViewT view_foundation(naturalNumber number) const;
+        /**
+         * \brief Return a read-only view of the deck without copying it
+         * \details The view is invalidated by the next move made on the board.
+         * \return View of the deck
+         */
+        PileViewT view_deck() const;
+        /**
+         * \brief Return a read-only view of the waste without copying it
+         * \details The view is invalidated by the next move made on the board.
+         * \return View of the waste
+         */
+        PileViewT view_waste() const;
         /**
          * \brief Check if there exist any more valid moves
+         * \details Runs in O(1): one AND of the exposed and wanted card masks kept
+         * up to date by every move.
          * \return True if there exists, false otherwise
          */
         bool valid_mv_exists();
         /**
          * \brief Check if the player have won the game
+         * \details Runs in O(1) from the count of completed foundations.
          * \return True if won, false otherwise
          */
         bool is_win_state();
+        /**
+         * \brief Return the 64-bit Zobrist hash of the position
+         * \details The hash is updated incrementally by every move, so this is a field read.
+         * \return Hash of the position
+         */
+        uint64_t hash() const;
+        /**
+         * \brief Return the position with its tableaus and foundations in canonical order
+         * \details Tableaus are interchangeable, and so are foundations since any of
+         * them takes any ace, so boards differing only in the order of these piles
+         * are the same position for solving. The canonical form sorts the tableaus,
+         * then the foundations, by their packed cards, bottom-most first, empty
+         * piles first. The deck and the waste are kept as they are.
+         * \return The position in canonical order
+         */
+        BoardT canonical() const;
+        /**
+         * \brief Return the 64-bit hash of the position up to the order of its piles
+         * \details Boards that differ only in the order of their tableaus or
+         * foundations have the same canonical hash, e.g. a board and its
+         * canonical(). Every pile is hashed on its own and the pile hashes are
+         * summed, all updated incrementally by every move, so this is a field read.
+         * \return Canonical hash of the position
+         */
+        uint64_t canonical_hash() const;
+        /**
+         * \brief Write the position into a compact binary snapshot
+         * \details The piles are copied as packed cards in the order given by
+         * SNAPSHOT_PILES, with their lengths and the hash.
+         * \return Snapshot of the position
+         */
+        BoardSnapshotT snapshot() const;
+        /**
+         * \brief Check if two boards hold the same position
+         * \param other The board being compared with
+         * \return True if every pile holds the same cards, false otherwise
+         */
+        bool operator==(const BoardT &other) const;
 };
 
 #endif
@@ -0,0 +1,64 @@
+/**
+ * \file MatchKernel.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines the vectorised top-card matching kernel used by move generation
+ */
+#ifndef A3_MATCH_KERNEL_H_
+#define A3_MATCH_KERNEL_H_
+
+//Importation
+#include "CardTypes.h"
+#include <stdint.h>
+
+/**
+ * \brief Number of destinations compared at once, one bit of a row each
+ */
+#define KERNEL_LANES 32
+
+/**
+ * \brief Most origins the kernel takes in one call
+ */
+#define KERNEL_ORIGINS 16
+
+/**
+ * \brief Describes an implementation of the kernel
+ */
+enum KernelT {ScalarKernel, Sse2Kernel, Avx2Kernel};
+
+/**
+ * \brief Compute which destinations accept which origins
+ * \details Bit j of rows[i] is set when accepts[j] equals origins[i]. A
+ * destination accepting no card should hold 0, which is never a card. Runs
+ * the kernel picked by set_match_kernel, by default the fastest one the
+ * processor supports.
+ * \param origins The cards being moved, 0 for none
+ * \param count Number of origins, at most KERNEL_ORIGINS
+ * \param accepts For each of the KERNEL_LANES destinations, the card it accepts
+ * \param rows Buffer of count rows the matrix is written to
+ */
+void match_matrix(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows);
+
+/**
+ * \brief Check if the processor can run an implementation of the kernel
+ * \param kernel The implementation
+ * \return True if it can, false otherwise
+ */
+bool match_kernel_supported(KernelT kernel);
+
+/**
+ * \brief Return the implementation match_matrix runs
+ * \return The implementation
+ */
+KernelT match_kernel();
+
+/**
+ * \brief Choose the implementation match_matrix runs
+ * \details For testing and benchmarking; every implementation gives the same rows.
+ * \param kernel The implementation
+ * \throws invalid_argument The processor cannot run the implementation
+ */
+void set_match_kernel(KernelT kernel);
+
+#endif
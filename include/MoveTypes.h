@@ -0,0 +1,88 @@
+/**
+ * \file MoveTypes.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines the types of a move and of its status
+ */
+#ifndef A3_MOVE_TYPES_H_
+#define A3_MOVE_TYPES_H_
+
+//Importation
+#include "CardTypes.h"
+
+/**
+ * \brief Describes the outcome of checking or making a move
+ */
+enum MoveStatusT {Legal, Illegal, BadPosition, EmptyOrigin};
+
+/**
+ * \brief Describes a move as a 4-byte tuple of origin and destination
+ * \details A tableau move has origin_category Tableau, a waste move has
+ * origin_category Waste and a deck move has origin_category Deck and
+ * category Waste. Unused numbers are 0.
+ */
+struct MoveT {
+    /**
+     * \brief Category of the pile the card is moved from (a CategoryT)
+     */
+    unsigned char origin_category;
+    /**
+     * \brief Place of the card being moved
+     */
+    unsigned char origin;
+    /**
+     * \brief Category of the destination (a CategoryT)
+     */
+    unsigned char category;
+    /**
+     * \brief Place the card is being moved to
+     */
+    unsigned char destination;
+};
+
+/**
+ * \brief Builds a move from the tableau
+ * \param category Category of the destination
+ * \param origin Place of card being moved
+ * \param destination Place the card is being moved to
+ * \return The move
+ */
+inline MoveT tab_move(CategoryT category, unsigned int origin, unsigned int destination) {
+    MoveT m = {Tableau, static_cast<unsigned char>(origin),
+               static_cast<unsigned char>(category), static_cast<unsigned char>(destination)};
+    return m;
+}
+
+/**
+ * \brief Builds a move from the waste
+ * \param category Category of the destination
+ * \param destination Place the card is being moved to
+ * \return The move
+ */
+inline MoveT waste_move(CategoryT category, unsigned int destination) {
+    MoveT m = {Waste, 0, static_cast<unsigned char>(category), static_cast<unsigned char>(destination)};
+    return m;
+}
+
+/**
+ * \brief Builds a move from the deck to the waste
+ * \return The move
+ */
+inline MoveT deck_move() {
+    MoveT m = {Deck, 0, Waste, 0};
+    return m;
+}
+
+/**
+ * \brief Check if two moves are the same
+ * \param m1 first move
+ * \param m2 second move
+ * \return True if the same, false otherwise
+ */
+inline bool operator==(MoveT m1, MoveT m2) {
+    return m1.origin_category == m2.origin_category && m1.origin == m2.origin
+        && m1.category == m2.category && m1.destination == m2.destination;
+}
+
+#endif
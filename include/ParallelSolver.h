@@ -0,0 +1,112 @@
+/**
+ * \file ParallelSolver.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a multithreaded work-stealing solver for Forty Thieves deals
+ */
+#ifndef A3_PARALLEL_SOLVER_H_
+#define A3_PARALLEL_SOLVER_H_
+
+//Importation
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Solver.h"
+#include "TransTable.h"
+#include <vector>
+#include <deque>
+#include <unordered_set>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <stdint.h>
+
+/**
+ * \brief Multithreaded depth-first solver with work stealing
+ * \details Each thread runs the same depth-first search as SolverT on its own
+ * board. A task is a position plus the moves leading to it. When a thread is
+ * idle, busy threads hand over the untried moves of their shallowest search
+ * depth as new tasks, and idle threads steal tasks from the front of the
+ * other threads' queues. A thread with nothing to take sleeps on a condition
+ * variable until a task is given or the search ends. Positions already reached by any thread are shared,
+ * by canonical hash, through one concurrent set, so no position is searched
+ * twice. A lock-free transposition table in front of the set answers most
+ * repeated positions without taking a lock.
+ */
+class ParallelSolverT {
+    private:
+        /**
+         * \brief A position to search and the moves leading to it from the start
+         */
+        struct TaskT {
+            BoardT board;
+            std::vector<MoveT> prefix;
+        };
+        /**
+         * \brief Task queue of one thread
+         */
+        struct WorkerT {
+            std::mutex lock;
+            std::deque<TaskT> tasks;
+            std::atomic<unsigned int> queued;
+        };
+        /**
+         * \brief Moves of one search depth and the next one to try
+         */
+        struct FrameT {
+            MoveT moves[MAX_MOVES];
+            unsigned char count;
+            unsigned char next;
+        };
+        static const unsigned int SEEN_SHARDS = 64;
+        unsigned int threads;
+        unsigned long long maxNodes;
+        std::vector<std::unique_ptr<WorkerT> > workers;
+        std::unordered_set<uint64_t> seen[SEEN_SHARDS];
+        std::mutex seenLock[SEEN_SHARDS];
+        TransTableT cache;
+        std::atomic<long> pending;
+        std::atomic<unsigned int> idle;
+        std::mutex idleLock;
+        std::condition_variable wake;
+        std::atomic<bool> stop;
+        std::atomic<bool> limitHit;
+        std::atomic<unsigned long long> nodes;
+        std::mutex resultLock;
+        SolveResultT result;
+        bool mark_seen(uint64_t hash, unsigned int depth);
+        void give(unsigned int id, TaskT &task);
+        bool take(unsigned int id, TaskT &task);
+        bool has_tasks();
+        void wake_all();
+        void work(unsigned int id);
+        void search(unsigned int id, TaskT &task);
+        void donate(unsigned int id, TaskT &task, BoardT &board,
+                    std::vector<FrameT> &frames, std::vector<MoveT> &line);
+    public:
+        /**
+         * \brief Constructor method for the class
+         * \param threads Number of threads searching, 0 for one per hardware thread
+         * \param maxNodes Most moves made by one search before giving up, 0 for no limit
+         * \param tableMegabytes Size of the transposition table in front of the set of reached positions
+         */
+        ParallelSolverT(unsigned int threads = 0, unsigned long long maxNodes = 0,
+                        unsigned int tableMegabytes = 64);
+        /**
+         * \brief Search a position for a win
+         * \param start The position searched from
+         * \return Result of the search
+         */
+        SolveResultT solve(BoardT start);
+        /**
+         * \brief Search a deal for a win
+         * \param cards Sequence of cards, dealt as by the BoardT constructor
+         * \return Result of the search
+         * \throws invalid_argument invalid argument exception when the cards given is not exactly two deck.
+         */
+        SolveResultT solve(std::vector<CardT> cards);
+};
+
+#endif
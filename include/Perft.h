@@ -0,0 +1,75 @@
+/**
+ * \file Perft.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines perft, the count of move sequences of a given length
+ */
+#ifndef A3_PERFT_H_
+#define A3_PERFT_H_
+
+//Importation
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+/**
+ * \brief Number of move sequences starting with one root move
+ */
+struct DivideT {
+    /**
+     * \brief The root move
+     */
+    MoveT move;
+    /**
+     * \brief Number of leaves below the root move
+     */
+    uint64_t nodes;
+};
+
+/**
+ * \brief Count the leaves of the move tree of a position
+ * \details A leaf is a sequence of exactly depth valid moves, or a shorter one
+ * ending in a position with no valid move. Uses generate_moves and make/unmake;
+ * the board is left as it was.
+ * \param board The position counted from
+ * \param depth Number of moves in a sequence
+ * \return Number of leaves
+ */
+uint64_t perft(BoardT &board, unsigned int depth);
+
+/**
+ * \brief Count the leaves of the move tree of a position the slow way
+ * \details Same count as perft, but moves are found by trying every location
+ * with is_valid_tab_mv, is_valid_waste_mv and is_valid_deck_mv and made with
+ * tab_mv, waste_mv and deck_mv on a copy of the board. Used to check perft.
+ * \param board The position counted from
+ * \param depth Number of moves in a sequence
+ * \return Number of leaves
+ */
+uint64_t perft_reference(const BoardT &board, unsigned int depth);
+
+/**
+ * \brief Count the leaves of the move tree below each root move
+ * \param board The position counted from
+ * \param depth Number of moves in a sequence, at least 1
+ * \return One entry per valid move of the position, in generate_moves order
+ */
+std::vector<DivideT> perft_divide(BoardT &board, unsigned int depth);
+
+/**
+ * \brief Count the distinct positions reachable from a position
+ * \details Positions are told apart by hash, or by canonical_hash if canonical is
+ * set, so boards differing only in the order of their tableaus or foundations
+ * are counted once. A position already seen is searched again only if it is
+ * reached with more moves left. The board is left as it was.
+ * \param board The position counted from
+ * \param depth Most moves made to reach a position
+ * \param canonical Whether to count positions in canonical form
+ * \return Number of distinct positions, the start position included
+ */
+uint64_t perft_distinct(BoardT &board, unsigned int depth, bool canonical = false);
+
+#endif
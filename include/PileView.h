@@ -0,0 +1,103 @@
+/**
+ * \file PileView.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a read-only view of a pile of packed cards
+ */
+#ifndef A3_PILE_VIEW_H_
+#define A3_PILE_VIEW_H_
+
+//Importation
+#include "CardTypes.h"
+#include <stdexcept>
+
+/**
+ * \brief Non-owning, read-only view of a pile on a board
+ * \details Holds a pointer to the bottom-most card and the number of cards, so
+ * it is built and copied without allocation. A view is invalidated by the next
+ * move made on the board it was taken from.
+ */
+class PileViewT {
+    private:
+        const PackedCardT *cards;
+        unsigned int length;
+    public:
+        /**
+         * \brief Constructor method for an empty view
+         */
+        PileViewT() : cards(0), length(0) {}
+        /**
+         * \brief Constructor method for the class
+         * \param cards First of the cards, bottom-most first
+         * \param length Number of cards
+         */
+        PileViewT(const PackedCardT *cards, unsigned int length) : cards(cards), length(length) {}
+        /**
+         * \brief Returns the number of cards in the pile
+         * \return The number of cards in the pile
+         */
+        unsigned int size() const {
+            return length;
+        }
+        /**
+         * \brief Check if the pile has no card
+         * \return True if empty, false otherwise
+         */
+        bool empty() const {
+            return length == 0;
+        }
+        /**
+         * \brief Returns a card of the pile without checking the index
+         * \param i Index of the card, 0 being the bottom-most
+         * \return The card
+         */
+        CardT operator[](unsigned int i) const {
+            return unpack_card(cards[i]);
+        }
+        /**
+         * \brief Returns a card of the pile
+         * \param i Index of the card, 0 being the bottom-most
+         * \return The card
+         * \throw out_of_range out of range exception when i is not less than size
+         */
+        CardT at(unsigned int i) const {
+            if (i >= length)
+                throw std::out_of_range("");
+            return unpack_card(cards[i]);
+        }
+        /**
+         * \brief Returns the card on the top of the pile
+         * \return The card on the top of the pile
+         * \throw out_of_range out of range exception when the pile is empty
+         */
+        CardT top() const {
+            if (length == 0)
+                throw std::out_of_range("");
+            return unpack_card(cards[length - 1]);
+        }
+        /**
+         * \brief Returns a card of the pile as a packed card without checking the index
+         * \param i Index of the card, 0 being the bottom-most
+         * \return The packed card
+         */
+        PackedCardT packed(unsigned int i) const {
+            return cards[i];
+        }
+        /**
+         * \brief Returns the first of the packed cards, for iteration
+         * \return Pointer to the bottom-most packed card
+         */
+        const PackedCardT *begin() const {
+            return cards;
+        }
+        /**
+         * \brief Returns one past the last of the packed cards, for iteration
+         * \return Pointer past the top-most packed card
+         */
+        const PackedCardT *end() const {
+            return cards + length;
+        }
+};
+
+#endif
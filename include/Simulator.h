@@ -0,0 +1,112 @@
+/**
+ * \file Simulator.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a Monte Carlo win-rate estimator over random deals
+ */
+#ifndef A3_SIMULATOR_H_
+#define A3_SIMULATOR_H_
+
+//Importation
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include <stdint.h>
+
+/**
+ * \brief Describes how a playout picks its moves
+ * \details RandomPolicy picks uniformly among all valid moves. GreedyFoundation
+ * plays a foundation move if there is one, then a waste to tableau move, then a
+ * random tableau move, and deals from the deck only when nothing else is left.
+ */
+enum PolicyT {RandomPolicy, GreedyFoundation};
+
+/**
+ * \brief Describes the result of a batch of playouts
+ */
+struct SimulationResultT {
+    /**
+     * \brief Number of games played
+     */
+    unsigned long long games;
+    /**
+     * \brief Number of games won
+     */
+    unsigned long long wins;
+    /**
+     * \brief Number of moves made over all games
+     */
+    unsigned long long moves;
+    /**
+     * \brief Fraction of games won
+     */
+    double winRate;
+    /**
+     * \brief Lower end of the 95% Wilson confidence interval of the win rate
+     */
+    double low;
+    /**
+     * \brief Upper end of the 95% Wilson confidence interval of the win rate
+     */
+    double high;
+    /**
+     * \brief Wall time of the batch in seconds
+     */
+    double seconds;
+};
+
+/**
+ * \brief Plays batches of random deals with a policy, across threads
+ * \details Game i of a batch plays deal number seed + i from deal_board, with
+ * moves drawn from its own DealRngT, so a batch gives the same result on any
+ * number of threads. Every thread keeps its own counters, added up after the
+ * threads finish, so no state is shared while playing.
+ */
+class SimulatorT {
+    private:
+        PolicyT policy;
+        unsigned int threads;
+        unsigned int maxMoves;
+        bool pruneDeadEnds;
+    public:
+        /**
+         * \brief Constructor method for the class
+         * \param policy How playouts pick their moves
+         * \param threads Number of threads playing, 0 for one per hardware thread
+         * \param maxMoves Most moves of one playout, a game still going then is lost
+         * \param pruneDeadEnds Whether a playout stops as lost once is_dead_end proves it
+         */
+        SimulatorT(PolicyT policy, unsigned int threads = 0, unsigned int maxMoves = 1000, bool pruneDeadEnds = true);
+        /**
+         * \brief Play a batch of random deals
+         * \details The same seed gives the same result on any number of threads.
+         * \param games Number of games played
+         * \param seed Seed of the random deals and moves
+         * \return Result of the batch
+         */
+        SimulationResultT run(unsigned long long games, uint64_t seed);
+        /**
+         * \brief Play one game out from a position
+         * \details If pruneDeadEnds is set, every few moves the position is
+         * checked with is_dead_end and a game proven lost stops there. The outcome is
+         * the same as playing on, so results do not change, only the board left.
+         * \param board The position, played in place
+         * \param random Random number generator the moves are drawn from
+         * \return True if the game was won, false otherwise
+         */
+        bool play(BoardT &board, DealRngT &random);
+        /**
+         * \brief Play one game out from a position and count the moves made
+         * \details As play(board, random); a game stopped as a dead end counts only
+         * the moves made before the stop.
+         * \param board The position, played in place
+         * \param random Random number generator the moves are drawn from
+         * \param made Increased by the number of moves made
+         * \return True if the game was won, false otherwise
+         */
+        bool play(BoardT &board, DealRngT &random, unsigned long long &made);
+};
+
+#endif
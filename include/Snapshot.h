@@ -0,0 +1,55 @@
+/**
+ * \file Snapshot.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines the compact binary snapshot format of a board
+ */
+#ifndef A3_SNAPSHOT_H_
+#define A3_SNAPSHOT_H_
+
+//Importation
+#include "CardTypes.h"
+
+/**
+ * \brief Version of the snapshot format written by this build
+ */
+#define SNAPSHOT_VERSION 1
+
+/**
+ * \brief Number of piles stored in a snapshot
+ * \details The tableaus, then the foundations, then the deck, then the waste.
+ */
+#define SNAPSHOT_PILES 20
+
+/**
+ * \brief Compact binary snapshot of a board
+ * \details Every field is made of bytes, so the struct has no padding, no
+ * alignment requirement and no byte order: a snapshot is written with a single
+ * write of sizeof(BoardSnapshotT) bytes and read back by pointing a
+ * BoardSnapshotT at the bytes, e.g. in a buffer or a mapped file.
+ */
+struct BoardSnapshotT {
+    /**
+     * \brief The bytes 'B', 'D', 'S', 'N'
+     */
+    unsigned char magic[4];
+    /**
+     * \brief Version of the format, SNAPSHOT_VERSION
+     */
+    unsigned char version;
+    /**
+     * \brief Number of cards in each pile, in the order given by SNAPSHOT_PILES
+     */
+    unsigned char lengths[SNAPSHOT_PILES];
+    /**
+     * \brief Zobrist hash of the position, least significant byte first
+     */
+    unsigned char hash[8];
+    /**
+     * \brief Packed cards of every pile one after another, bottom-most first
+     */
+    PackedCardT cards[TOTAL_CARD];
+};
+
+#endif
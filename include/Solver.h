@@ -0,0 +1,113 @@
+/**
+ * \file Solver.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a depth-first solver for Forty Thieves deals
+ */
+#ifndef A3_SOLVER_H_
+#define A3_SOLVER_H_
+
+//Importation
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include <vector>
+#include <unordered_set>
+#include <stdint.h>
+
+/**
+ * \brief Describes the outcome of a search
+ * \details Unknown means the node limit was reached before the search ended.
+ */
+enum SolveStatusT {Solved, Unsolvable, Unknown};
+
+/**
+ * \brief Describes the result of a search
+ */
+struct SolveResultT {
+    /**
+     * \brief Outcome of the search
+     */
+    SolveStatusT status;
+    /**
+     * \brief Winning sequence of moves from the start position, empty unless Solved
+     */
+    std::vector<MoveT> moves;
+    /**
+     * \brief Number of moves made during the search
+     */
+    unsigned long long nodes;
+    /**
+     * \brief Wall time of the search in seconds
+     */
+    double seconds;
+    /**
+     * \brief Returns the search throughput
+     * \return Nodes searched per second
+     */
+    double nodes_per_second() const {
+        return seconds > 0 ? nodes / seconds : 0;
+    }
+};
+
+/**
+ * \brief Put the moves worth searching first and drop useless ones
+ * \details Foundation moves come first and the deck move last. Moving the
+ * only card of a tableau to an empty tableau is dropped, since it leads to
+ * the same position with two piles swapped. Every move of a position
+ * is_dead_end proves lost is dropped, so searches back out of it at once.
+ * If a move is_safe_mv, it is kept alone, since it is as good as any other.
+ * \param board The position the moves were generated for
+ * \param moves The moves, reordered in place
+ * \param count Number of moves
+ * \return Number of moves kept
+ */
+unsigned int order_moves(BoardT &board, MoveT *moves, unsigned int count);
+
+/**
+ * \brief Depth-first solver with transposition detection
+ * \details Runs on a single board with make/unmake and remembers the canonical
+ * hash of every position reached, so no position is searched twice, nor one
+ * differing from it only in the order of its tableaus or foundations. Unsolvable
+ * is a proof that the whole reachable tree was searched, assuming no two reached
+ * positions share a 64-bit hash.
+ */
+class SolverT {
+    private:
+        /**
+         * \brief Moves of one search depth and the next one to try
+         */
+        struct FrameT {
+            MoveT moves[MAX_MOVES];
+            unsigned char count;
+            unsigned char next;
+        };
+        unsigned long long maxNodes;
+        BoardT board;
+        std::unordered_set<uint64_t> seen;
+        std::vector<FrameT> frames;
+        std::vector<MoveT> line;
+        void push_frame();
+    public:
+        /**
+         * \brief Constructor method for the class
+         * \param maxNodes Most moves made by one search before giving up, 0 for no limit
+         */
+        SolverT(unsigned long long maxNodes = 0);
+        /**
+         * \brief Search a position for a win
+         * \param start The position searched from
+         * \return Result of the search
+         */
+        SolveResultT solve(BoardT start);
+        /**
+         * \brief Search a deal for a win
+         * \param cards Sequence of cards, dealt as by the BoardT constructor
+         * \return Result of the search
+         * \throws invalid_argument invalid argument exception when the cards given is not exactly two deck.
+         */
+        SolveResultT solve(std::vector<CardT> cards);
+};
+
+#endif
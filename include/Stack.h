@@ -2,7 +2,7 @@
  * \file Stack.h
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/09
- * \date Last modified 2019/03/21
+ * \date Last modified 2026/10/17
  * \brief Defines a generic stack
  */
 #ifndef A3_STACK_H_
@@ -57,6 +57,25 @@ class Stack {
          * \return Sequence of element in the stack
          */
         std::vector<T> toSeq();
+        /**
+         * \brief Add a element to the top of this stack in place.
+         * \details Unlike push, no new Stack object is created.
+         * \param element Element being added
+         */
+        void push_inplace(T element);
+        /**
+         * \brief Remove the top-most element of this stack in place.
+         * \details Unlike pop, no new Stack object is created.
+         * \throw out_of_range out of range exception when stack is empty
+         */
+        void pop_inplace();
+        /**
+         * \brief Returns a reference to the element on the top of stack
+         * \details The reference is invalidated by the next push_inplace or pop_inplace.
+         * \return Reference to the element on the top of stack
+         * \throw out_of_range out of range exception when stack is empty
+         */
+        const T &top_ref();
 };
 
 #endif
@@ -0,0 +1,136 @@
+/**
+ * \file TransTable.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines a fixed-size transposition table keyed by board hash
+ */
+#ifndef A3_TRANS_TABLE_H_
+#define A3_TRANS_TABLE_H_
+
+//Importation
+#include "MoveTypes.h"
+#include <atomic>
+#include <stdint.h>
+
+//Define constant and type
+/**
+ * \brief Largest depth an entry holds, deeper entries are stored as this
+ */
+#define TRANS_MAX_DEPTH 8191
+
+/**
+ * \brief Describes what the value stored with a position is
+ */
+enum BoundT {NoBound, LowerBound, UpperBound, ExactBound};
+
+/**
+ * \brief Describes which entry of a full bucket a store replaces
+ * \details AlwaysReplace takes a slot picked by bits of the new key, whatever
+ * it holds, DepthPreferred takes the slot with the smallest depth.
+ */
+enum ReplacementT {AlwaysReplace, DepthPreferred};
+
+/**
+ * \brief Information stored with a position
+ */
+struct TransEntryT {
+    /**
+     * \brief Remaining search depth below the position, the larger the more
+     * work the entry saves, so DepthPreferred keeps the deepest entries
+     */
+    unsigned short depth;
+    /**
+     * \brief What value is
+     */
+    BoundT bound;
+    /**
+     * \brief Value of the position, meaning is up to the search
+     */
+    short value;
+    /**
+     * \brief Best move found from the position
+     */
+    MoveT best;
+};
+
+/**
+ * \brief Fixed-size transposition table, lock-free for probes and stores
+ * \details Entries are grouped in 64-byte buckets of four, one cache line
+ * each. An entry is two 64-bit atomics: the packed data and the key XORed
+ * with the data. A writer claims its slot with a compare-and-swap on the data
+ * before writing, so two writers never mix their words, and a probe never
+ * returns data stored for another key. Probes and stores never wait, a store
+ * meeting another writer drops its entry. Only insert, which must answer
+ * exactly, waits for a writer still filling a slot of its bucket.
+ */
+class TransTableT {
+    private:
+        /**
+         * \brief One slot of a bucket
+         */
+        struct SlotT {
+            std::atomic<uint64_t> check;
+            std::atomic<uint64_t> data;
+        };
+        /**
+         * \brief Four slots filling one cache line
+         */
+        struct alignas(64) BucketT {
+            SlotT slots[4];
+        };
+        BucketT *buckets;
+        uint64_t mask;
+        ReplacementT policy;
+        bool put(uint64_t key, TransEntryT entry, bool overwrite);
+        TransTableT(const TransTableT &);
+        TransTableT &operator=(const TransTableT &);
+    public:
+        /**
+         * \brief Constructor method for the class
+         * \param megabytes Size of the table, rounded down to a power of two buckets
+         * \param policy Replacement policy used by store
+         */
+        TransTableT(unsigned int megabytes, ReplacementT policy = DepthPreferred);
+        /**
+         * \brief Destructor method for the class
+         */
+        ~TransTableT();
+        /**
+         * \brief Look a position up
+         * \param key Hash of the position
+         * \param entry Set to the stored information if found
+         * \return True if found, false otherwise
+         */
+        bool probe(uint64_t key, TransEntryT &entry) const;
+        /**
+         * \brief Store information about a position
+         * \details An entry with the same key is always overwritten, otherwise an
+         * empty slot is used, otherwise the replacement policy picks the slot. Never
+         * waits: if another writer holds a slot of the bucket, the entry is dropped.
+         * \param key Hash of the position
+         * \param entry Information being stored
+         */
+        void store(uint64_t key, TransEntryT entry);
+        /**
+         * \brief Store a position unless it is already stored
+         * \details Checking and storing is one atomic step, so of several threads
+         * inserting the same key at once only one gets true.
+         * \param key Hash of the position
+         * \param entry Information being stored
+         * \return True if the position was not stored before, false otherwise
+         */
+        bool insert(uint64_t key, TransEntryT entry);
+        /**
+         * \brief Remove every entry
+         * \details Not safe to call while other threads use the table.
+         */
+        void clear();
+        /**
+         * \brief Returns the number of entries the table can hold
+         * \return Number of slots
+         */
+        uint64_t capacity() const;
+};
+
+#endif
@@ -0,0 +1,97 @@
+/**
+ * \file main.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Counts the move tree of a deal and reports nodes per second
+ * \details Usage: perft SEED DEPTH [divide|reference|distinct]. divide prints
+ * the count below each root move, reference also counts with perft_reference
+ * and fails if the two counts differ, distinct also counts the distinct
+ * positions within DEPTH moves, as they are and in canonical form.
+ */
+//Importation
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include "Perft.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+//Name of a move, e.g. t3-f0 for tableau 3 to foundation 0
+void print_move(MoveT move) {
+    const char origins[] = {'t', 'f', 'd', 'w'};
+    if (move.origin_category == Deck) {
+        std::printf("d-w");
+        return;
+    }
+    std::printf("%c", origins[move.origin_category]);
+    if (move.origin_category == Tableau)
+        std::printf("%u", move.origin);
+    std::printf("-%c%u", origins[move.category], move.destination);
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s SEED DEPTH [divide|reference|distinct]\n", argv[0]);
+        return 2;
+    }
+    uint64_t seed = std::strtoull(argv[1], NULL, 10);
+    unsigned int depth = std::strtoul(argv[2], NULL, 10);
+    const char *mode = argc > 3 ? argv[3] : "";
+    BoardT board = deal_board(seed);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint64_t nodes = 0;
+    if (std::strcmp(mode, "divide") == 0 && depth > 0) {
+        std::vector<DivideT> divide = perft_divide(board, depth);
+        for (unsigned int i = 0; i < divide.size(); i++) {
+            print_move(divide[i].move);
+            std::printf(" %llu\n", (unsigned long long)divide[i].nodes);
+            nodes += divide[i].nodes;
+        }
+        if (divide.empty())
+            nodes = 1;
+    } else {
+        nodes = perft(board, depth);
+    }
+    double seconds = seconds_since(start);
+    std::printf("seed %llu depth %u nodes %llu time %.3f s nps %.0f\n",
+                (unsigned long long)seed, depth, (unsigned long long)nodes,
+                seconds, seconds > 0 ? nodes / seconds : 0);
+    
+    if (std::strcmp(mode, "reference") == 0) {
+        start = std::chrono::steady_clock::now();
+        uint64_t reference = perft_reference(board, depth);
+        seconds = seconds_since(start);
+        std::printf("reference nodes %llu time %.3f s nps %.0f\n", (unsigned long long)reference,
+                    seconds, seconds > 0 ? reference / seconds : 0);
+        if (reference != nodes) {
+            std::printf("MISMATCH\n");
+            return 1;
+        }
+    }
+    
+    if (std::strcmp(mode, "distinct") == 0) {
+        start = std::chrono::steady_clock::now();
+        uint64_t positions = perft_distinct(board, depth);
+        uint64_t canonical = perft_distinct(board, depth, true);
+        seconds = seconds_since(start);
+        std::printf("distinct positions %llu canonical %llu (%.2f%% fewer) time %.3f s\n",
+                    (unsigned long long)positions, (unsigned long long)canonical,
+                    positions > 0 ? 100.0 * (positions - canonical) / positions : 0, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * \file DeadEnd.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the static check for positions that can no longer be won
+ */
+//Importation
+#include "DeadEnd.h"
+#include <stdint.h>
+
+//Every ace, in a mask indexed by packed card
+static const uint64_t ACE_MASK = 0xFULL << (4 * ACE);
+
+/**
+ * \brief Grow a set of cards along same-suit runs until it stops changing
+ * \details A card joins the set when it is allowed and either is in seed or the
+ * card of its suit one rank lower (if up) or higher (otherwise) is in the set.
+ * \param set The starting set, indexed by packed card
+ * \param allowed Cards allowed to join
+ * \param up True to follow runs up from the ace, false down from the king
+ * \param seed Cards that may join on their own
+ * \return The grown set
+ */
+static uint64_t close_runs(uint64_t set, uint64_t allowed, bool up, uint64_t seed) {
+    for (;;) {
+        uint64_t next = set | (allowed & ((up ? set << 4 : set >> 4) | seed));
+        if (next == set)
+            return set;
+        set = next;
+    }
+}
+
+/**
+ * \brief Check if a position is provably lost
+ * \details Finds, as a least fixpoint, every card that could ever leave its
+ * pile, every card that could ever reach a foundation and every card that could
+ * ever lie on top of a tableau, assuming no tableau is ever empty. Each fact is
+ * only derived once the facts any real move would need are, so a card not found
+ * to leave never does. If no tableau can be cleared that way, none ever will be,
+ * so the game cannot be won: e.g. when both copies of a card are buried under
+ * cards that wait for it. Runs on the piles in place, allocates nothing and
+ * never reports a winnable position as lost.
+ * \param board The position
+ * \return True if the game cannot be won from the position, false if it may be
+ */
+bool is_dead_end(const BoardT &board) {
+    //An empty tableau takes any card, nothing can be proven
+    PileViewT tabs[TAB_SIZE];
+    for (int i = 0; i < TAB_SIZE; i++) {
+        tabs[i] = board.view_tab(i);
+        if (tabs[i].empty())
+            return false;
+    }
+    PileViewT waste = board.view_waste();
+    //Sets of cards, indexed by packed card. Both copies of a card share a bit,
+    //so a fact about a card holds for either copy
+    uint64_t founded = 0;
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        PileViewT foundation = board.view_foundation(i);
+        for (const PackedCardT *c = foundation.begin(); c != foundation.end(); c++)
+            founded |= 1ULL << *c;
+    }
+    //Cards that could be on top of a pile: every card of the deck gets dealt
+    uint64_t exposed = 0;
+    PileViewT deck = board.view_deck();
+    for (const PackedCardT *c = deck.begin(); c != deck.end(); c++)
+        exposed |= 1ULL << *c;
+    //Cards that could be on top of a tableau without having been moved there
+    uint64_t tabExposed = 0;
+    for (;;) {
+        //A card reaches a foundation once the one below it in the suit has
+        uint64_t reach = close_runs(founded, exposed, true, ACE_MASK);
+        //A card gets on a tableau top by being on one or moving onto one
+        uint64_t onTab = close_runs(tabExposed, exposed, false, 0);
+        //A card leaves for a foundation or for a tableau top one rank higher
+        uint64_t leaves = reach << 4 | ACE_MASK | onTab >> 4;
+        uint64_t oldExposed = exposed;
+        uint64_t oldTabExposed = tabExposed;
+        for (int i = 0; i < TAB_SIZE; i++) {
+            //A card is uncovered once every card above it has left
+            int j = tabs[i].size() - 1;
+            for (; j >= 0; j--) {
+                uint64_t bit = 1ULL << tabs[i].packed(j);
+                tabExposed |= bit;
+                exposed |= bit;
+                if (!(leaves & bit))
+                    break;
+            }
+            //Every card of the tableau could leave
+            if (j < 0)
+                return false;
+        }
+        for (int j = waste.size() - 1; j >= 0; j--) {
+            uint64_t bit = 1ULL << waste.packed(j);
+            exposed |= bit;
+            if (!(leaves & bit))
+                break;
+        }
+        //Nothing new could be uncovered, so nothing more could leave
+        if (exposed == oldExposed && tabExposed == oldTabExposed)
+            return true;
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * \file Deal.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the seeded deal generator
+ */
+//Importation
+#include "Deal.h"
+
+/**
+ * \brief Rotate a 64-bit number left
+ * \param x The number
+ * \param k Number of bits
+ * \return The rotated number
+ */
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * \brief Constructor method for the class
+ * \param seed The seed, expanded into the state with splitmix64
+ */
+DealRngT::DealRngT(uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        state[i] = z ^ (z >> 31);
+    }
+}
+
+/**
+ * \brief Returns the next 64-bit number
+ * \return The number
+ */
+uint64_t DealRngT::next() {
+    uint64_t result = rotl(state[1] * 5, 7) * 9;
+    uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl(state[3], 45);
+    return result;
+}
+
+/**
+ * \brief Returns a number in [0, bound)
+ * \details Takes the high 32 bits of next() and multiplies by bound,
+ * keeping the high 32 bits of the product. The bias is below 2^-24
+ * for the bounds a deal uses.
+ * \param bound Upper bound, at most 2^32
+ * \return The number
+ */
+uint32_t DealRngT::bounded(uint32_t bound) {
+    return (uint32_t)(((next() >> 32) * bound) >> 32);
+}
+
+/**
+ * \brief Deal number seed as packed cards
+ * \details Starts from two decks ordered by rank, then suit, each card twice,
+ * and shuffles them with Fisher-Yates from the last card down, using
+ * DealRngT(seed).bounded(i + 1) for position i.
+ * \param seed Number of the deal
+ * \param out Buffer of TOTAL_CARD packed cards the deal is written to
+ */
+void deal_packed(uint64_t seed, PackedCardT *out) {
+    //Ordered decks: packed values 4..55, each twice
+    for (int i = 0; i < TOTAL_CARD; i++)
+        out[i] = static_cast<PackedCardT>(4 + i / 2);
+    DealRngT rng(seed);
+    for (int i = TOTAL_CARD - 1; i > 0; i--) {
+        int j = rng.bounded(i + 1);
+        PackedCardT temp = out[i];
+        out[i] = out[j];
+        out[j] = temp;
+    }
+}
+
+/**
+ * \brief Deal number seed as a sequence of cards, ready for the BoardT constructor
+ * \param seed Number of the deal
+ * \return Sequence of TOTAL_CARD cards
+ */
+std::vector<CardT> deal_cards(uint64_t seed) {
+    PackedCardT packed[TOTAL_CARD];
+    deal_packed(seed, packed);
+    std::vector<CardT> cards(TOTAL_CARD);
+    for (int i = 0; i < TOTAL_CARD; i++)
+        cards[i] = unpack_card(packed[i]);
+    return cards;
+}
+
+/**
+ * \brief Deal number seed straight onto a board
+ * \details The deal is known to be two decks, so the board skips that check.
+ * \param seed Number of the deal
+ * \return The board of the deal
+ */
+BoardT deal_board(uint64_t seed) {
+    PackedCardT packed[TOTAL_CARD];
+    deal_packed(seed, packed);
+    return BoardT(packed, false);
+}
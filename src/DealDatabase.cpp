@@ -0,0 +1,232 @@
+/**
+ * \file DealDatabase.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the memory-mapped deal database
+ */
+//Importation
+#include "DealDatabase.h"
+#include <stdexcept>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+//First bytes of every deal database
+static const unsigned char DEAL_DB_MAGIC[4] = {'B', 'D', 'D', 'B'};
+
+//Value stored in byteOrder
+static const uint32_t DEAL_DB_BYTE_ORDER = 0x01020304;
+
+static_assert(sizeof(DealDbHeaderT) == 64, "the header is one cache line");
+static_assert(sizeof(DealRecordT) == 128, "records are two cache lines");
+
+/**
+ * \brief Constructor method for the class
+ * \details Creates the file, replacing any file of the same name.
+ * \param path Path of the file
+ * \throws runtime_error The file cannot be created
+ */
+DealDbWriterT::DealDbWriterT(const std::string &path) : file(0), count(0) {
+    file = std::fopen(path.c_str(), "wb");
+    if (file == 0)
+        throw std::runtime_error("");
+    write_header();
+}
+
+/**
+ * \brief Destructor method for the class, closes the file
+ */
+DealDbWriterT::~DealDbWriterT() {
+    if (file == 0)
+        return;
+    try {
+        close();
+    } catch (const std::runtime_error &) {
+        //Nothing more can be done about it here
+    }
+}
+
+/**
+ * \brief Write the header with the current count at the start of the file
+ * \throws runtime_error The header cannot be written
+ */
+void DealDbWriterT::write_header() {
+    DealDbHeaderT header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, DEAL_DB_MAGIC, sizeof(header.magic));
+    header.version = DEAL_DB_VERSION;
+    header.byteOrder = DEAL_DB_BYTE_ORDER;
+    header.stride = sizeof(DealRecordT);
+    header.count = count;
+    long position = std::ftell(file);
+    if (std::fseek(file, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, file) != 1)
+        throw std::runtime_error("");
+    if (position > 0 && std::fseek(file, position, SEEK_SET) != 0)
+        throw std::runtime_error("");
+}
+
+/**
+ * \brief Append a deal with no result yet
+ * \param cards Sequence of TOTAL_CARD packed cards
+ * \param seed Seed the deal was generated from, or 0
+ * \return Index of the record
+ * \throws runtime_error The record cannot be written
+ */
+uint64_t DealDbWriterT::append(const PackedCardT *cards, uint64_t seed) {
+    DealRecordT record;
+    std::memset(&record, 0, sizeof(record));
+    std::memcpy(record.cards, cards, TOTAL_CARD);
+    record.seed = seed;
+    record.status = Unknown;
+    return append(record);
+}
+
+/**
+ * \brief Append a complete record
+ * \param record The record
+ * \return Index of the record
+ * \throws runtime_error The record cannot be written
+ */
+uint64_t DealDbWriterT::append(const DealRecordT &record) {
+    if (file == 0 || std::fwrite(&record, sizeof(record), 1, file) != 1)
+        throw std::runtime_error("");
+    return count++;
+}
+
+/**
+ * \brief Write the final header and close the file
+ * \details Called by the destructor if not called before.
+ * \throws runtime_error The file cannot be written
+ */
+void DealDbWriterT::close() {
+    if (file == 0)
+        return;
+    bool failed = false;
+    try {
+        write_header();
+    } catch (const std::runtime_error &) {
+        failed = true;
+    }
+    failed = std::fclose(file) != 0 || failed;
+    file = 0;
+    if (failed)
+        throw std::runtime_error("");
+}
+
+/**
+ * \brief Constructor method for the class
+ * \param path Path of a file written by DealDbWriterT
+ * \param writable Whether results can be set
+ * \throws runtime_error The file cannot be opened or mapped
+ * \throws invalid_argument The file is not a deal database of this version and byte order
+ */
+DealDbT::DealDbT(const std::string &path, bool writable)
+        : mapping(MAP_FAILED), length(0), records(0), count(0), writable(writable) {
+    int fd = open(path.c_str(), writable ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("");
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("");
+    }
+    length = info.st_size;
+    if (length < sizeof(DealDbHeaderT)) {
+        ::close(fd);
+        throw std::invalid_argument("");
+    }
+    mapping = mmap(0, length, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    //The mapping keeps the file open
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+        throw std::runtime_error("");
+    //Check the header
+    const DealDbHeaderT *header = static_cast<const DealDbHeaderT *>(mapping);
+    if (std::memcmp(header->magic, DEAL_DB_MAGIC, sizeof(header->magic)) != 0
+            || header->version != DEAL_DB_VERSION || header->byteOrder != DEAL_DB_BYTE_ORDER
+            || header->stride != sizeof(DealRecordT)
+            || header->count > (length - sizeof(DealDbHeaderT)) / sizeof(DealRecordT)) {
+        munmap(mapping, length);
+        throw std::invalid_argument("");
+    }
+    count = header->count;
+    records = reinterpret_cast<DealRecordT *>(static_cast<unsigned char *>(mapping) + sizeof(DealDbHeaderT));
+    //Batch jobs stream through the records in order
+    madvise(mapping, length, MADV_SEQUENTIAL);
+}
+
+/**
+ * \brief Destructor method for the class, unmaps the file
+ */
+DealDbT::~DealDbT() {
+    munmap(mapping, length);
+}
+
+/**
+ * \brief Returns the number of deals
+ * \return The number of deals
+ */
+uint64_t DealDbT::size() const {
+    return count;
+}
+
+/**
+ * \brief Returns one of the records without copying it
+ * \param index Index of the record
+ * \return Reference into the mapping
+ * \throws out_of_range Invalid index
+ */
+const DealRecordT &DealDbT::record(uint64_t index) const {
+    if (index >= count)
+        throw std::out_of_range("");
+    return records[index];
+}
+
+/**
+ * \brief Returns the first of the records, for streaming through them
+ * \return Pointer into the mapping
+ */
+const DealRecordT *DealDbT::begin() const {
+    return records;
+}
+
+/**
+ * \brief Returns one past the last of the records
+ * \return Pointer into the mapping
+ */
+const DealRecordT *DealDbT::end() const {
+    return records + count;
+}
+
+/**
+ * \brief Construct the start position of one of the deals
+ * \details The board is filled straight from the packed cards of the record.
+ * \param index Index of the record
+ * \param check Whether to check that the cards are exactly two deck
+ * \return The start position
+ * \throws out_of_range Invalid index
+ * \throws invalid_argument A byte of the record is not a card, or check is set and the cards are not exactly two deck
+ */
+BoardT DealDbT::board(uint64_t index, bool check) const {
+    return BoardT(record(index).cards, check);
+}
+
+/**
+ * \brief Record the result of solving one of the deals
+ * \param index Index of the record
+ * \param result The result
+ * \throws out_of_range Invalid index
+ * \throws logic_error The database was not opened writable
+ */
+void DealDbT::set_result(uint64_t index, const SolveResultT &result) {
+    if (index >= count)
+        throw std::out_of_range("");
+    if (!writable)
+        throw std::logic_error("");
+    records[index].nodes = result.nodes;
+    records[index].moves = result.moves.size();
+    records[index].status = result.status;
+}
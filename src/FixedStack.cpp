@@ -0,0 +1,161 @@
+/**
+ * \file FixedStack.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the generic stack with a compile-time capacity
+ */
+//Importation
+#include "FixedStack.h"
+#include "CardStack.h"
+#include <stdexcept>
+
+/**
+ * \brief Default constructor for the class
+ */
+template <class T, unsigned int N>
+FixedStack<T, N>::FixedStack() : stack(), length(0) {
+    static_assert(N <= 255, "FixedStack stores its length in one byte");
+}
+
+/**
+ * \brief Constructor method for the class.
+ * \details Set up with the given list of element
+ * \param stack Initial list of element in the stack
+ * \throw out_of_range out of range exception when the list is longer than N
+ */
+template <class T, unsigned int N>
+FixedStack<T, N>::FixedStack(std::vector<T> stack) : stack(), length(0) {
+    if (stack.size() > N) {
+        throw std::out_of_range("");
+    }
+    for (unsigned int i = 0; i < stack.size(); i++)
+        this->stack[i] = stack[i];
+    length = stack.size();
+}
+
+/**
+ * \brief Add a element to the top of stack.
+ * \param element Element being added
+ * \return A new FixedStack object with given element on top
+ * \throw out_of_range out of range exception when stack is full
+ */
+template <class T, unsigned int N>
+FixedStack<T, N> FixedStack<T, N>::push(T element) {
+    FixedStack<T, N> newStack = *this;
+    newStack.push_inplace(element);
+    return newStack;
+}
+
+/**
+ * \brief Remove a element from the top of stack.
+ * \return A new FixedStack object without the top-most element
+ * \throw out_of_range out of range exception when stack is empty
+ */
+template <class T, unsigned int N>
+FixedStack<T, N> FixedStack<T, N>::pop() {
+    FixedStack<T, N> newStack = *this;
+    newStack.pop_inplace();
+    return newStack;
+}
+
+/**
+ * \brief Returns the element on the top of stack
+ * \return The element on the top of stack
+ * \throw out_of_range out of range exception when stack is empty
+ */
+template <class T, unsigned int N>
+T FixedStack<T, N>::top() {
+    return top_ref();
+}
+
+/**
+ * \brief Returns the size of the stack
+ * \return The size of the stack
+ */
+template <class T, unsigned int N>
+unsigned int FixedStack<T, N>::size() const {
+    return length;
+}
+
+/**
+ * \brief Returns the sequence of element in the stack
+ * \return Sequence of element in the stack
+ */
+template <class T, unsigned int N>
+std::vector<T> FixedStack<T, N>::toSeq() {
+    return std::vector<T>(stack, stack + length);
+}
+
+/**
+ * \brief Add a element to the top of this stack in place.
+ * \param element Element being added
+ * \throw out_of_range out of range exception when stack is full
+ */
+template <class T, unsigned int N>
+void FixedStack<T, N>::push_inplace(T element) {
+    if (length == N) {
+        throw std::out_of_range("");
+    }
+    stack[length++] = element;
+}
+
+/**
+ * \brief Remove the top-most element of this stack in place.
+ * \throw out_of_range out of range exception when stack is empty
+ */
+template <class T, unsigned int N>
+void FixedStack<T, N>::pop_inplace() {
+    if (length == 0) {
+        throw std::out_of_range("");
+    }
+    stack[--length] = T();
+}
+
+/**
+ * \brief Returns a reference to the element on the top of stack
+ * \details The reference is invalidated by the next push_inplace or pop_inplace.
+ * \return Reference to the element on the top of stack
+ * \throw out_of_range out of range exception when stack is empty
+ */
+template <class T, unsigned int N>
+const T &FixedStack<T, N>::top_ref() {
+    if (length == 0) {
+        throw std::out_of_range("");
+    }
+    return stack[length-1];
+}
+
+/**
+ * \brief Replace the content of this stack in place
+ * \param elements First of the elements, bottom-most first
+ * \param count Number of elements
+ * \throw out_of_range out of range exception when count is bigger than N
+ */
+template <class T, unsigned int N>
+void FixedStack<T, N>::assign(const T *elements, unsigned int count) {
+    if (count > N) {
+        throw std::out_of_range("");
+    }
+    for (unsigned int i = 0; i < count; i++)
+        stack[i] = elements[i];
+    for (unsigned int i = count; i < length; i++)
+        stack[i] = T();
+    length = count;
+}
+
+/**
+ * \brief Returns the elements of the stack without copying them
+ * \details The pointer stays valid for the life of the stack, but the
+ * elements past size() are unused.
+ * \return Pointer to the bottom-most element
+ */
+template <class T, unsigned int N>
+const T *FixedStack<T, N>::data() const {
+    return stack;
+}
+
+// Keep this at bottom
+template class FixedStack<PackedCardT, TAB_CAPACITY>;
+template class FixedStack<PackedCardT, FOUND_CAPACITY>;
+template class FixedStack<PackedCardT, PILE_CAPACITY>;
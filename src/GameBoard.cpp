@@ -2,23 +2,152 @@
  * \file GameBoard.cpp
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/09
- * \date Last modified 2019/03/25
+ * \date Last modified 2026/10/17
  * \brief Implimentation of the gameboard class for the game
  */
 //Importation
 #include "GameBoard.h"
+#include "MatchKernel.h"
 #include <stdexcept>
+#include <cstring>
+#include <algorithm>
+
+//Zobrist slot of each pile
+#define TAB_SLOT 0
+#define FOUND_SLOT (TAB_SLOT + TAB_SIZE)
+#define DECK_SLOT (FOUND_SLOT + FOUND_SIZE)
+#define WASTE_SLOT (DECK_SLOT + 1)
+
+//First lane of the foundations in the matching kernel
+#define FOUND_LANE 16
+
+static_assert(TAB_SIZE <= FOUND_LANE && FOUND_LANE + FOUND_SIZE <= KERNEL_LANES, "every destination has a lane");
+static_assert(TAB_SIZE + 1 <= KERNEL_ORIGINS, "every origin fits in one kernel call");
+
+//First bytes of every snapshot
+static const unsigned char SNAPSHOT_MAGIC[4] = {'B', 'D', 'S', 'N'};
+
+static_assert(WASTE_SLOT + 1 == SNAPSHOT_PILES, "a snapshot stores every Zobrist slot as one pile");
+static_assert(sizeof(BoardSnapshotT) == 4 + 1 + SNAPSHOT_PILES + 8 + TOTAL_CARD, "snapshots have no padding");
+
+static_assert(SUMMARY_SIZE <= 64 && 2 < (1 << EXPOSED_BITS) && FOUND_SIZE + 4 < (1 << WANTED_BITS),
+    "every count of the move summary fits in its slices");
+//Boards are copied per search task, per playout and per stored position
+static_assert(sizeof(BoardT) <= 656, "a board stays within 656 bytes");
+
+/**
+ * \brief Scramble the bits of a 64-bit value with the splitmix64 finaliser
+ * \param z The value
+ * \return The scrambled value, 0 for 0
+ */
+static uint64_t mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * \brief Zobrist key of a card lying at a given depth of a given pile
+ * \details Keys are produced by the splitmix64 finaliser instead of a lookup
+ * table, which keeps them identical on every platform and out of the cache.
+ * \param slot Zobrist slot of the pile
+ * \param depth Position of the card in the pile, 0 being the bottom
+ * \param card The packed card
+ * \return The key
+ */
+static uint64_t zobrist_key(unsigned int slot, unsigned int depth, PackedCardT card) {
+    return mix(((uint64_t)slot << 16 | (uint64_t)depth << 8 | card) * 0x9E3779B97F4A7C15ULL);
+}
+
+/**
+ * \brief Unpack a sequence of packed cards into a card stack
+ * \param cards Sequence of packed cards
+ * \return Card stack holding the same cards
+ */
+static CardStackT unpack_stack(std::vector<PackedCardT> cards) {
+    std::vector<CardT> unpacked(cards.size());
+    for (unsigned int i = 0; i < cards.size(); i++)
+        unpacked[i] = unpack_card(cards[i]);
+    return CardStackT(unpacked);
+}
+
+/**
+ * \brief Sort piles by their packed cards, bottom-most first, shorter first on a tie
+ * \details Sorts indices rather than piles, by insertion since there are at most ten.
+ * \param piles The piles
+ * \param count Number of piles
+ * \param order Receives the indices of the piles in sorted order
+ */
+template <class StackT>
+static void sort_piles(const StackT *piles, int count, unsigned char *order) {
+    for (int i = 0; i < count; i++) {
+        const PackedCardT *cards = piles[i].data();
+        unsigned int size = piles[i].size();
+        int j = i;
+        for (; j > 0; j--) {
+            const StackT &other = piles[order[j - 1]];
+            if (!std::lexicographical_compare(cards, cards + size, other.data(), other.data() + other.size()))
+                break;
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+}
+
+/**
+ * \brief Check that every byte of a sequence is a packed card
+ * \details One compare per byte, cheap enough to run even when the two-deck
+ * check is skipped, and enough to keep the move summary tables in bounds.
+ * \param cards Sequence of packed cards
+ * \param count Number of cards
+ * \return True if every card has a suit and a rank from ACE to KING, false otherwise
+ */
+static bool are_cards(const PackedCardT *cards, unsigned int count) {
+    for (unsigned int i = 0; i < count; i++) {
+        if (packed_rank(cards[i]) < ACE || packed_rank(cards[i]) > KING)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * \brief Check that a sequence of packed cards is exactly two deck
+ * \param cards Sequence of TOTAL_CARD packed cards
+ * \return True if every card appears exactly twice, false otherwise
+ */
+static bool is_two_decks(const PackedCardT *cards) {
+    int count[SUMMARY_SIZE] = {0};
+    for (int i = 0; i < TOTAL_CARD; i++) {
+        if (cards[i] >= SUMMARY_SIZE)
+            return false;
+        count[cards[i]] += 1;
+    }
+    for (int i = 0; i < SUMMARY_SIZE; i++) {
+        bool isCard = packed_rank(i) >= ACE && packed_rank(i) <= KING;
+        if (count[i] != (isCard ? 2 : 0))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * \brief Check if a card can go to a foundation without ever being needed on a tableau
+ * \param card The card
+ * \param heights Heights of the two foundations of each suit, 0 for a missing one
+ * \return True if both cards of its suit one rank lower are on the foundations
+ */
+static bool is_safe_card(PackedCardT card, const unsigned char heights[4][2]) {
+    SuitT suit = packed_suit(card);
+    unsigned int low = std::min(heights[suit][0], heights[suit][1]);
+    return packed_rank(card) <= low + 1;
+}
 
 /**
  * \brief Default constructor method for the class
  */
-BoardT::BoardT() {
-    for (int i = 0; i < TAB_SIZE; i++)
-        tableau[i] = *(new CardStackT());
-    for (int i = 0; i < FOUND_SIZE; i++)
-        foundation[i] = *(new CardStackT());
-    deck = *(new CardStackT());
-    waste = *(new CardStackT());
+BoardT::BoardT() : zobrist(0) {
+    init_summary();
+    init_canonical();
 }
 
 /**
@@ -27,9 +156,10 @@ BoardT::BoardT() {
  * \param cards Sequence of cards
  * \throws invalid_argument invalid argument exception when the cards given is not exactly two deck.
  */
-BoardT::BoardT(std::vector<CardT> cards) {
+BoardT::BoardT(const std::vector<CardT> &cards) : zobrist(0) {
     //Declare variables
     int check[13][4] = {0};
+    PackedCardT packed[TOTAL_CARD];
     //Check if the given sequence of cards is exactly two deck
     if (cards.size() != 104)
         throw std::invalid_argument("");
@@ -42,16 +172,98 @@ BoardT::BoardT(std::vector<CardT> cards) {
         }
     }
     //Create the different sections of the game board
+    for (int i = 0; i < TOTAL_CARD; i++)
+        packed[i] = pack_card(cards[i]);
+    deal(packed);
+}
+
+/**
+ * \brief Constructor method of the class from packed cards.
+ * \details First 40 cards goes into the tableau, the rest of cards goes to deck.
+ * Cards are dealt straight into the piles with no intermediate copies.
+ * The bytes are always checked to be cards, check adds the count of each card.
+ * \param cards Sequence of TOTAL_CARD packed cards
+ * \param check Whether to check that the cards are exactly two deck
+ * \throws invalid_argument invalid argument exception when a byte is not a card, or when check
+ * is set and the cards given is not exactly two deck.
+ */
+BoardT::BoardT(const PackedCardT *cards, bool check) : zobrist(0) {
+    if (!are_cards(cards, TOTAL_CARD) || (check && !is_two_decks(cards)))
+        throw std::invalid_argument("");
+    deal(cards);
+}
+
+/**
+ * \brief Constructor method of the class from a snapshot.
+ * \details The piles are filled straight from the packed cards of the snapshot.
+ * The header, the pile lengths and that every byte is a card are always
+ * checked. Unless check or rehash is set, the hash stored in the snapshot is trusted.
+ * \param snapshot Snapshot written by snapshot()
+ * \param check Whether to check the count of each card, that every pile could arise in a game
+ * and the hash of the snapshot
+ * \param rehash Whether to compute the hash from the cards instead of taking the stored one
+ * \throws invalid_argument invalid argument exception when the header, the pile lengths or a
+ * card are not valid, or when check is set and the cards or the hash are not valid.
+ */
+BoardT::BoardT(const BoardSnapshotT &snapshot, bool check, bool rehash) : zobrist(0) {
+    //Check the header and the pile lengths
+    if (std::memcmp(snapshot.magic, SNAPSHOT_MAGIC, sizeof(snapshot.magic)) != 0
+            || snapshot.version != SNAPSHOT_VERSION)
+        throw std::invalid_argument("");
+    const unsigned char *lengths = snapshot.lengths;
+    unsigned int total = 0;
+    for (int i = 0; i < SNAPSHOT_PILES; i++) {
+        unsigned int capacity = i < FOUND_SLOT ? TAB_CAPACITY : i < DECK_SLOT ? FOUND_CAPACITY : PILE_CAPACITY;
+        if (lengths[i] > capacity)
+            throw std::invalid_argument("");
+        total += lengths[i];
+    }
+    if (total != TOTAL_CARD)
+        throw std::invalid_argument("");
+    if (!are_cards(snapshot.cards, TOTAL_CARD) || (check && !is_two_decks(snapshot.cards)))
+        throw std::invalid_argument("");
+    //Fill the piles
+    const PackedCardT *cards = snapshot.cards;
+    init_summary();
+    //Cards leave the deck only for the waste, so the two never hold more than the deck did
+    if (check && lengths[DECK_SLOT] + lengths[WASTE_SLOT] > PILE_CAPACITY)
+        throw std::invalid_argument("");
     for (int i = 0; i < TAB_SIZE; i++) {
-        std::vector<CardT> temp(cards.begin()+(4*i), cards.begin()+(4*i+4));
-        tableau[i] = *(new CardStackT(temp));
+        //Uncovering the card at j and building down to the ace fills j + rank
+        //places, at most 3 + KING for a dealt tableau, so a tableau that could
+        //outgrow its capacity never came from a game
+        for (unsigned int j = 0; check && j < lengths[TAB_SLOT + i]; j++) {
+            if (j + packed_rank(cards[j]) > TAB_CAPACITY)
+                throw std::invalid_argument("");
+        }
+        tab_top_changed(i, -1);
+        tableau[i].assign(cards, lengths[TAB_SLOT + i]);
+        tab_top_changed(i, 1);
+        cards += lengths[TAB_SLOT + i];
     }
     for (int i = 0; i < FOUND_SIZE; i++) {
-        foundation[i] = *(new CardStackT());
+        //A foundation holds a run of one suit from the ace up
+        for (unsigned int j = 0; check && j < lengths[FOUND_SLOT + i]; j++) {
+            if (packed_rank(cards[j]) != ACE + j || packed_suit(cards[j]) != packed_suit(cards[0]))
+                throw std::invalid_argument("");
+        }
+        found_top_changed(i, -1);
+        foundation[i].assign(cards, lengths[FOUND_SLOT + i]);
+        found_top_changed(i, 1);
+        cards += lengths[FOUND_SLOT + i];
     }
-    std::vector<CardT> temp(cards.begin()+40, cards.begin()+104);
-    deck = *(new CardStackT(temp));
-    waste = *(new CardStackT());
+    deck.assign(cards, lengths[DECK_SLOT]);
+    cards += lengths[DECK_SLOT];
+    waste.assign(cards, lengths[WASTE_SLOT]);
+    waste_top_changed(1);
+    //Take the hash as stored, or compute it
+    for (int i = 7; i >= 0; i--)
+        zobrist = zobrist << 8 | snapshot.hash[i];
+    if (check && zobrist != compute_hash())
+        throw std::invalid_argument("");
+    if (rehash)
+        zobrist = compute_hash();
+    init_canonical();
 }
 
 /**
@@ -63,28 +275,10 @@ BoardT::BoardT(std::vector<CardT> cards) {
  * \throws out_of_range Location is not valid
  */
 bool BoardT::is_valid_tab_mv(CategoryT category, naturalNumber origin, naturalNumber destination) {
-    //Check for exception
-    if (category == Tableau || category == Foundation) {
-        if (!is_valid_pos(Tableau, origin) || !is_valid_pos(category, destination))
-            throw std::out_of_range("");
-    }
-    //Check if the move is valid
-    if (category == Deck || category == Waste)
-        return false;
-    if (tableau[origin].size() == 0)
-        return false;
-    else if (category == Tableau) {
-        if (tableau[destination].size() == 0)
-            return true;
-        else
-            return tab_placeable(tableau[origin].top(), tableau[destination].top());
-    }
-    else {
-        if (foundation[destination].size() == 0)
-            return tableau[origin].top().r == ACE;
-        else
-            return foundation_placeable(tableau[origin].top(), foundation[destination].top());
-    }
+    MoveStatusT status = check_tab_mv(category, origin, destination);
+    if (status == BadPosition)
+        throw std::out_of_range("");
+    return status == Legal;
 }
 
 /**
@@ -96,36 +290,20 @@ bool BoardT::is_valid_tab_mv(CategoryT category, naturalNumber origin, naturalNu
  * \throws invalid_argument No card in waste
  */
 bool BoardT::is_valid_waste_mv(CategoryT category, naturalNumber destination) {
-    //Check for exception
-    if (category == Tableau || category == Foundation) {
-        if (!is_valid_pos(category, destination))
-            throw std::out_of_range("");
-    }
-    if (waste.size() == 0)
+    MoveStatusT status = check_waste_mv(category, destination);
+    if (status == BadPosition)
+        throw std::out_of_range("");
+    if (status == EmptyOrigin)
         throw std::invalid_argument("");
-    //Check if the move is valid
-    if (category == Deck || category == Waste)
-        return false;
-    else if (category == Tableau) {
-        if (tableau[destination].size() == 0)
-            return true;
-        else
-            return tab_placeable(waste.top(), tableau[destination].top());
-    }
-    else {
-        if (foundation[destination].size() == 0)
-            return waste.top().r == ACE;
-        else
-            return foundation_placeable(waste.top(), foundation[destination].top());
-    }
+    return status == Legal;
 }
 
 /**
- * \brief Check if the size of deck is bigger than 0
- * \return True if bigger, false otherwise
+ * \brief Check if the size of deck is bigger than 0 and the waste is not full
+ * \return True if so, false otherwise
  */
 bool BoardT::is_valid_deck_mv() {
-    return (deck.size() > 0);
+    return deck.size() > 0 && waste.size() < PILE_CAPACITY;
 }
 
 /**
@@ -136,16 +314,11 @@ bool BoardT::is_valid_deck_mv() {
  * \throws invalid_argument Cannot move the card
  */
 void BoardT::tab_mv(CategoryT category, naturalNumber origin, naturalNumber destination) {
-    if (!is_valid_tab_mv(category, origin, destination))
+    MoveStatusT status = try_tab_mv(category, origin, destination);
+    if (status == BadPosition)
+        throw std::out_of_range("");
+    if (status != Legal)
         throw std::invalid_argument("");
-    if (category == Tableau) {
-        tableau[destination] = tableau[destination].push(tableau[origin].top());
-        tableau[origin] = tableau[origin].pop();
-    }
-    else if (category == Foundation) {
-        foundation[destination] = foundation[destination].push(tableau[origin].top());
-        tableau[origin] = tableau[origin].pop();
-    }
 }
 
 /**
@@ -155,16 +328,11 @@ void BoardT::tab_mv(CategoryT category, naturalNumber origin, naturalNumber dest
  * \throws invalid_argument Cannot move the card
  */
 void BoardT::waste_mv(CategoryT category, naturalNumber destination) {
-    if (!is_valid_waste_mv(category, destination))
+    MoveStatusT status = try_waste_mv(category, destination);
+    if (status == BadPosition)
+        throw std::out_of_range("");
+    if (status != Legal)
         throw std::invalid_argument("");
-    if (category == Tableau) {
-        tableau[destination] = tableau[destination].push(waste.top());
-        waste = waste.pop();
-    }
-    else if (category == Foundation) {
-        foundation[destination] = foundation[destination].push(waste.top());
-        waste = waste.pop();
-    }
 }
 
 /**
@@ -172,10 +340,295 @@ void BoardT::waste_mv(CategoryT category, naturalNumber destination) {
  * \throws invalid_argument Cannot move the card
  */
 void BoardT::deck_mv() {
-    if (!is_valid_deck_mv())
+    if (try_deck_mv() != Legal)
         throw std::invalid_argument("");
-    waste = waste.push(deck.top());
-    deck = deck.pop();
+}
+
+/**
+ * \brief Check if the move (from the tableau) is valid without throwing
+ * \param category Category of the destination
+ * \param origin Place of card being moved
+ * \param destination Place the card is being moved to
+ * \return Legal if valid, BadPosition if a location is not valid, EmptyOrigin
+ * if the tableau is empty, Illegal otherwise, also when the destination is full
+ */
+MoveStatusT BoardT::check_tab_mv(CategoryT category, naturalNumber origin, naturalNumber destination) noexcept {
+    //Check for bad position
+    if (category == Tableau || category == Foundation) {
+        if (!is_valid_pos(Tableau, origin) || !is_valid_pos(category, destination))
+            return BadPosition;
+    }
+    //Check if the move is valid
+    if (category == Deck || category == Waste)
+        return Illegal;
+    if (tableau[origin].size() == 0)
+        return EmptyOrigin;
+    PackedCardT card = tableau[origin].top_ref();
+    //A full pile takes no more cards, e.g. on a board loaded unchecked
+    if (category == Tableau ? tableau[destination].size() == TAB_CAPACITY
+            : foundation[destination].size() == FOUND_CAPACITY)
+        return Illegal;
+    if (category == Tableau) {
+        if (tableau[destination].size() == 0 || tab_placeable(card, tableau[destination].top_ref()))
+            return Legal;
+    }
+    else {
+        if (foundation[destination].size() == 0 ? packed_rank(card) == ACE
+                : foundation_placeable(card, foundation[destination].top_ref()))
+            return Legal;
+    }
+    return Illegal;
+}
+
+/**
+ * \brief Check if the move (from the waste) is valid without throwing
+ * \param category Category of the destination
+ * \param destination Place the card is being moved to
+ * \return Legal if valid, BadPosition if the location is not valid, EmptyOrigin
+ * if the waste is empty, Illegal otherwise, also when the destination is full
+ */
+MoveStatusT BoardT::check_waste_mv(CategoryT category, naturalNumber destination) noexcept {
+    //Check for bad position
+    if (category == Tableau || category == Foundation) {
+        if (!is_valid_pos(category, destination))
+            return BadPosition;
+    }
+    if (waste.size() == 0)
+        return EmptyOrigin;
+    //Check if the move is valid
+    if (category == Deck || category == Waste)
+        return Illegal;
+    PackedCardT card = waste.top_ref();
+    //A full pile takes no more cards, e.g. on a board loaded unchecked
+    if (category == Tableau ? tableau[destination].size() == TAB_CAPACITY
+            : foundation[destination].size() == FOUND_CAPACITY)
+        return Illegal;
+    if (category == Tableau) {
+        if (tableau[destination].size() == 0 || tab_placeable(card, tableau[destination].top_ref()))
+            return Legal;
+    }
+    else {
+        if (foundation[destination].size() == 0 ? packed_rank(card) == ACE
+                : foundation_placeable(card, foundation[destination].top_ref()))
+            return Legal;
+    }
+    return Illegal;
+}
+
+/**
+ * \brief Move a card from tableau to tableau or foundation if the move is valid
+ * \param category Category of the destination
+ * \param origin Place of card being moved
+ * \param destination Place the card is being moved to
+ * \return Status of the move as given by check_tab_mv, the move is made only if Legal
+ */
+MoveStatusT BoardT::try_tab_mv(CategoryT category, naturalNumber origin, naturalNumber destination) noexcept {
+    MoveStatusT status = check_tab_mv(category, origin, destination);
+    if (status == Legal)
+        make(tab_move(category, origin, destination));
+    return status;
+}
+
+/**
+ * \brief Move a card from waste to tableau or foundation if the move is valid
+ * \param category Category of the destination
+ * \param destination Place the card is being moved to
+ * \return Status of the move as given by check_waste_mv, the move is made only if Legal
+ */
+MoveStatusT BoardT::try_waste_mv(CategoryT category, naturalNumber destination) noexcept {
+    MoveStatusT status = check_waste_mv(category, destination);
+    if (status == Legal)
+        make(waste_move(category, destination));
+    return status;
+}
+
+/**
+ * \brief Move a card from deck to waste if the deck is not empty and the waste not full
+ * \return Legal if the move was made, EmptyOrigin if the deck is empty, Illegal if the waste is full
+ */
+MoveStatusT BoardT::try_deck_mv() noexcept {
+    if (deck.size() == 0)
+        return EmptyOrigin;
+    if (waste.size() == PILE_CAPACITY)
+        return Illegal;
+    make(deck_move());
+    return Legal;
+}
+
+/**
+ * \brief List every valid move of the position
+ * \details Reads each pile's top card once, allocates nothing and throws nothing.
+ * Unless a tableau is empty, only tops in the wanted card mask are tried, and
+ * those are matched against every destination at once by match_matrix.
+ * Tableau moves come first, then waste moves, then the deck move.
+ * \param out Buffer of at least MAX_MOVES moves the valid moves are written to
+ * \return Number of moves written
+ */
+unsigned int BoardT::generate_moves(MoveT *out) noexcept {
+    //Card each destination accepts, tableaus from lane 0 and foundations from
+    //lane FOUND_LANE, 0 when it accepts none or when it is empty
+    PackedCardT accepts[KERNEL_LANES] = {0};
+    uint32_t emptyTabMask = 0;
+    uint32_t emptyFoundMask = 0;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        if (tableau[i].size() == 0) {
+            emptyTabMask |= 1u << i;
+            continue;
+        }
+        PackedCardT card = tableau[i].top_ref();
+        accepts[i] = packed_rank(card) > ACE && tableau[i].size() < TAB_CAPACITY ? card - 4 : 0;
+    }
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        if (foundation[i].size() == 0) {
+            emptyFoundMask |= 1u << i;
+            continue;
+        }
+        PackedCardT card = foundation[i].top_ref();
+        accepts[FOUND_LANE + i] = packed_rank(card) < KING && foundation[i].size() < FOUND_CAPACITY ? card + 4 : 0;
+    }
+    //Origins are the tableau tops then the waste top, as pile TAB_SIZE. Cards
+    //with somewhere to go are the wanted ones, or all of them if a tableau is empty
+    uint64_t movable = emptyTabs > 0 ? ~0ULL : wantedMask;
+    PackedCardT origins[TAB_SIZE + 1];
+    unsigned char piles[TAB_SIZE + 1];
+    unsigned int count = 0;
+    for (int i = 0; i <= TAB_SIZE; i++) {
+        if (i < TAB_SIZE ? tableau[i].size() == 0 : waste.size() == 0)
+            continue;
+        PackedCardT card = i < TAB_SIZE ? tableau[i].top_ref() : waste.top_ref();
+        if ((movable >> card & 1) == 0)
+            continue;
+        origins[count] = card;
+        piles[count++] = i;
+    }
+    uint32_t rows[TAB_SIZE + 1];
+    if (count > 0)
+        match_matrix(origins, count, accepts, rows);
+    unsigned int n = 0;
+    //Moves from tableau, then from waste
+    for (unsigned int k = 0; k < count; k++) {
+        PackedCardT card = origins[k];
+        int i = piles[k];
+        uint32_t tabs = (rows[k] & ((1u << TAB_SIZE) - 1)) | emptyTabMask;
+        uint32_t foundations = rows[k] >> FOUND_LANE;
+        if (packed_rank(card) == ACE)
+            foundations |= emptyFoundMask;
+        for (; tabs != 0; tabs &= tabs - 1) {
+            int j = __builtin_ctz(tabs);
+            out[n++] = i < TAB_SIZE ? tab_move(Tableau, i, j) : waste_move(Tableau, j);
+        }
+        for (; foundations != 0; foundations &= foundations - 1) {
+            int j = __builtin_ctz(foundations);
+            out[n++] = i < TAB_SIZE ? tab_move(Foundation, i, j) : waste_move(Foundation, j);
+        }
+    }
+    //Move from deck
+    if (deck.size() > 0 && waste.size() < PILE_CAPACITY)
+        out[n++] = deck_move();
+    return n;
+}
+
+/**
+ * \brief Apply a move without checking it
+ * \details The move must be valid, i.e. is_valid_tab_mv, is_valid_waste_mv
+ * or is_valid_deck_mv holds for it. Runs in O(1) with no allocation.
+ * \param move The move being made
+ */
+void BoardT::make(MoveT move) {
+    PackedCardT card;
+    if (move.origin_category == Tableau)
+        card = lift_tab(move.origin);
+    else if (move.origin_category == Waste)
+        card = lift_waste();
+    else
+        card = lift_deck();
+    if (move.category == Tableau)
+        drop_tab(move.destination, card);
+    else if (move.category == Foundation)
+        drop_foundation(move.destination, card);
+    else
+        drop_waste(card);
+}
+
+/**
+ * \brief Take back a move made by make, tab_mv, waste_mv or deck_mv
+ * \details The move must be the last one made on the board. The board is
+ * restored bit for bit, hash included.
+ * \param move The move being taken back
+ */
+void BoardT::unmake(MoveT move) {
+    PackedCardT card;
+    if (move.category == Tableau)
+        card = lift_tab(move.destination);
+    else if (move.category == Foundation)
+        card = lift_foundation(move.destination);
+    else
+        card = lift_waste();
+    if (move.origin_category == Tableau)
+        drop_tab(move.origin, card);
+    else if (move.origin_category == Waste)
+        drop_waste(card);
+    else
+        drop_deck(card);
+}
+
+/**
+ * \brief Check if a move puts a card on a foundation that no tableau can need again
+ * \details A card is only ever needed on a tableau to take the card of its
+ * suit one rank lower, so it is safe once both copies of that card are on
+ * the foundations, i.e. aces always are and any other card is when both
+ * foundations of its suit are at least one rank below it. Playing a safe
+ * move never turns a winnable position into a lost one. Runs in O(1), the
+ * heights of the foundations being kept with the board.
+ * \param move A valid move
+ * \return True if the move is safe, false otherwise
+ */
+bool BoardT::is_safe_mv(MoveT move) {
+    if (move.category != Foundation)
+        return false;
+    PackedCardT card = move.origin_category == Tableau ? tableau[move.origin].top_ref() : waste.top_ref();
+    return is_safe_card(card, suitHeights);
+}
+
+/**
+ * \brief Play every safe move to the foundations, see is_safe_mv
+ * \details Reads the foundation heights kept with the board, so every
+ * tableau and waste top is checked without validating moves, and goes round
+ * the piles until no top is safe. The moves are made with make and can be
+ * taken back with unmake in reverse order.
+ * \return The moves made, in order
+ */
+std::vector<MoveT> BoardT::auto_play_safe() {
+    std::vector<MoveT> made;
+    //A card played can make the top of a pile already checked safe
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        //Tableaus, then the waste as origin TAB_SIZE
+        for (int i = 0; i <= TAB_SIZE; i++) {
+            for (;;) {
+                unsigned int size = i < TAB_SIZE ? tableau[i].size() : waste.size();
+                if (size == 0)
+                    break;
+                PackedCardT card = i < TAB_SIZE ? tableau[i].top_ref() : waste.top_ref();
+                if (!is_safe_card(card, suitHeights))
+                    break;
+                //An ace goes on an empty foundation, any other card on the one below it
+                PackedCardT below = packed_rank(card) == ACE ? 0 : card - 4;
+                int j = 0;
+                while (j < FOUND_SIZE && (foundation[j].size() == 0 ? below != 0
+                        : foundation[j].top_ref() != below || foundation[j].size() == FOUND_CAPACITY))
+                    j++;
+                if (j == FOUND_SIZE)
+                    break;
+                MoveT move = i < TAB_SIZE ? tab_move(Foundation, i, j) : waste_move(Foundation, j);
+                make(move);
+                made.push_back(move);
+                moved = true;
+            }
+        }
+    }
+    return made;
 }
 
 /**
@@ -187,7 +640,19 @@ void BoardT::deck_mv() {
 CardStackT BoardT::get_tab(naturalNumber number) {
     if (!is_valid_pos(Tableau, number))
         throw std::out_of_range("");
-    return tableau[number];
+    return unpack_stack(tableau[number].toSeq());
+}
+
+/**
+ * \brief Return the number of cards in one of the tableaus without copying it
+ * \param number The number of the tableau
+ * \return Number of cards in the tableau
+ * \throws out_of_range Invalid position
+ */
+unsigned int BoardT::get_tab_size(naturalNumber number) {
+    if (!is_valid_pos(Tableau, number))
+        throw std::out_of_range("");
+    return tableau[number].size();
 }
 
 /**
@@ -199,7 +664,7 @@ CardStackT BoardT::get_tab(naturalNumber number) {
 CardStackT BoardT::get_foundation(naturalNumber number) {
     if (!is_valid_pos(Foundation, number))
         throw std::out_of_range("");
-    return foundation[number];
+    return unpack_stack(foundation[number].toSeq());
 }
 
 /**
@@ -207,7 +672,7 @@ CardStackT BoardT::get_foundation(naturalNumber number) {
  * \return deck
  */
 CardStackT BoardT::get_deck() {
-    return deck;
+    return unpack_stack(deck.toSeq());
 }
 
 /**
@@ -215,56 +680,167 @@ CardStackT BoardT::get_deck() {
  * \return waste
  */
 CardStackT BoardT::get_waste() {
-    return waste;
+    return unpack_stack(waste.toSeq());
+}
+
+/**
+ * \brief Return a read-only view of one of the tableaus without copying it
+ * \details The view is invalidated by the next move made on the board.
+ * \param number The number of the tableau
+ * \return View of the tableau
+ * \throws out_of_range Invalid position
+ */
+PileViewT BoardT::view_tab(naturalNumber number) const {
+    if (number >= TAB_SIZE)
+        throw std::out_of_range("");
+    return PileViewT(tableau[number].data(), tableau[number].size());
+}
+
+/**
+ * \brief Return a read-only view of one of the foundations without copying it
+ * \details The view is invalidated by the next move made on the board.
+ * \param number The number of the foundation
+ * \return View of the foundation
+ * \throws out_of_range Invalid position
+ */
+PileViewT BoardT::view_foundation(naturalNumber number) const {
+    if (number >= FOUND_SIZE)
+        throw std::out_of_range("");
+    return PileViewT(foundation[number].data(), foundation[number].size());
+}
+
+/**
+ * \brief Return a read-only view of the deck without copying it
+ * \details The view is invalidated by the next move made on the board.
+ * \return View of the deck
+ */
+PileViewT BoardT::view_deck() const {
+    return PileViewT(deck.data(), deck.size());
+}
+
+/**
+ * \brief Return a read-only view of the waste without copying it
+ * \details The view is invalidated by the next move made on the board.
+ * \return View of the waste
+ */
+PileViewT BoardT::view_waste() const {
+    return PileViewT(waste.data(), waste.size());
 }
 
 /**
  * \brief Check if there exist any more valid moves
+ * \details Runs in O(1): one AND of the exposed and wanted card masks kept
+ * up to date by every move.
  * \return True if there exists, false otherwise
  */
 bool BoardT::valid_mv_exists() {
     //Check for move from deck
-    if (is_valid_deck_mv())
+    if (deck.size() > 0 && waste.size() < PILE_CAPACITY)
         return true;
-    //Check for move from tableau
-    for (int i = 0; i < TAB_SIZE; i++) {
-        for (int j = 0; j < TAB_SIZE; j++) {
-            if (is_valid_tab_mv(Tableau, i, j))
-                return true;
-        }
-        for (int j = 0; j < FOUND_SIZE; j++) {
-            if (is_valid_tab_mv(Foundation, i, j))
-                return true;
-        }
-    }
-    //Check for move from waste
-    try {
-        for (int i = 0; i < TAB_SIZE; i++) {
-            if (is_valid_waste_mv(Tableau, i))
-                return true;
-        }
-        for (int i = 0; i < FOUND_SIZE; i++) {
-            if (is_valid_waste_mv(Foundation, i))
-                return true;
-        }
-    } catch (std::invalid_argument &e) {}
-    return false;
+    //Check for a tableau or waste top wanted by a tableau or foundation
+    if ((exposedMask & wantedMask) != 0)
+        return true;
+    //Check for move to an empty tableau
+    return emptyTabs > 0 && (emptyTabs < TAB_SIZE || waste.size() > 0);
 }
 
 /**
  * \brief Check if the player have won the game
+ * \details Runs in O(1) from the count of completed foundations.
  * \return True if won, false otherwise
  */
 bool BoardT::is_win_state() {
-    bool win = true;
-    for (int i = 0; i <= 7; i++) {
-        if (foundation[i].size() == 0)
-            win = false;
-        else
-            if (foundation[i].top().r != KING)
-                win = false;
+    return kings == FOUND_SIZE;
+}
+
+/**
+ * \brief Return the 64-bit Zobrist hash of the position
+ * \details The hash is updated incrementally by every move, so this is a field read.
+ * \return Hash of the position
+ */
+uint64_t BoardT::hash() const {
+    return zobrist;
+}
+
+/**
+ * \brief Return the position with its tableaus and foundations in canonical order
+ * \details Tableaus are interchangeable, and so are foundations since any of
+ * them takes any ace, so boards differing only in the order of these piles
+ * are the same position for solving. The canonical form sorts the tableaus,
+ * then the foundations, by their packed cards, bottom-most first, empty
+ * piles first. The deck and the waste are kept as they are.
+ * \return The position in canonical order
+ */
+BoardT BoardT::canonical() const {
+    unsigned char tabs[TAB_SIZE];
+    unsigned char founds[FOUND_SIZE];
+    sort_piles(tableau, TAB_SIZE, tabs);
+    sort_piles(foundation, FOUND_SIZE, founds);
+    //The move summary and the canonical hash do not depend on the order of the piles
+    BoardT out = *this;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        out.tableau[i] = tableau[tabs[i]];
+        out.pileHashes[i] = pileHashes[tabs[i]];
+    }
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        out.foundation[i] = foundation[founds[i]];
+        out.pileHashes[TAB_SIZE + i] = pileHashes[TAB_SIZE + founds[i]];
+    }
+    out.zobrist = out.compute_hash();
+    return out;
+}
+
+/**
+ * \brief Return the 64-bit hash of the position up to the order of its piles
+ * \details Boards that differ only in the order of their tableaus or
+ * foundations have the same canonical hash, e.g. a board and its
+ * canonical(). Every pile is hashed on its own and the pile hashes are
+ * summed, all updated incrementally by every move, so this is a field read.
+ * \return Canonical hash of the position
+ */
+uint64_t BoardT::canonical_hash() const {
+    return canon;
+}
+
+/**
+ * \brief Write the position into a compact binary snapshot
+ * \details The piles are copied as packed cards in the order given by
+ * SNAPSHOT_PILES, with their lengths and the hash.
+ * \return Snapshot of the position
+ */
+BoardSnapshotT BoardT::snapshot() const {
+    BoardSnapshotT out;
+    PackedCardT *cards = out.cards;
+    std::memcpy(out.magic, SNAPSHOT_MAGIC, sizeof(out.magic));
+    out.version = SNAPSHOT_VERSION;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        out.lengths[TAB_SLOT + i] = tableau[i].size();
+        cards = std::copy(tableau[i].data(), tableau[i].data() + tableau[i].size(), cards);
     }
-    return win;
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        out.lengths[FOUND_SLOT + i] = foundation[i].size();
+        cards = std::copy(foundation[i].data(), foundation[i].data() + foundation[i].size(), cards);
+    }
+    out.lengths[DECK_SLOT] = deck.size();
+    cards = std::copy(deck.data(), deck.data() + deck.size(), cards);
+    out.lengths[WASTE_SLOT] = waste.size();
+    std::copy(waste.data(), waste.data() + waste.size(), cards);
+    for (int i = 0; i < 8; i++)
+        out.hash[i] = static_cast<unsigned char>(zobrist >> (8 * i));
+    return out;
+}
+
+/**
+ * \brief Check if two boards hold the same position
+ * \param other The board being compared with
+ * \return True if every pile holds the same cards, false otherwise
+ */
+bool BoardT::operator==(const BoardT &other) const {
+    //Unused pile slots are kept zeroed, so the piles compare bitwise
+    const char *begin = reinterpret_cast<const char *>(tableau);
+    const char *end = reinterpret_cast<const char *>(&waste + 1);
+    return zobrist == other.zobrist
+        && std::memcmp(begin, other.tableau, end - begin) == 0;
 }
 
 /**
@@ -296,8 +872,8 @@ bool BoardT::is_valid_pos(CategoryT category, naturalNumber number) {
  * \param card2 second card
  * \return True if you can, false otherwise
  */
-bool BoardT::tab_placeable(CardT card1, CardT card2) {
-    return (card1.s == card2.s && card1.r == card2.r-1);
+bool BoardT::tab_placeable(PackedCardT card1, PackedCardT card2) {
+    return (card1 + 4 == card2);
 }
 
 /**
@@ -306,6 +882,307 @@ bool BoardT::tab_placeable(CardT card1, CardT card2) {
  * \param card2 second card
  * \return True if you can, false otherwise
  */
-bool BoardT::foundation_placeable(CardT card1, CardT card2) {
-    return (card1.s == card2.s && card1.r == card2.r+1);
+bool BoardT::foundation_placeable(PackedCardT card1, PackedCardT card2) {
+    return (card1 == card2 + 4);
+}
+
+/**
+ * \brief Remove the top card of a tableau and update the hash
+ * \param number The number of the tableau
+ * \return The card removed
+ */
+PackedCardT BoardT::lift_tab(naturalNumber number) {
+    PackedCardT card = tableau[number].top_ref();
+    tab_top_changed(number, -1);
+    tableau[number].pop_inplace();
+    tab_top_changed(number, 1);
+    zobrist ^= zobrist_key(TAB_SLOT + number, tableau[number].size(), card);
+    pile_changed(number, zobrist_key(TAB_SLOT, tableau[number].size(), card));
+    return card;
+}
+
+/**
+ * \brief Put a card on top of a tableau and update the hash
+ * \param number The number of the tableau
+ * \param card The card being put
+ */
+void BoardT::drop_tab(naturalNumber number, PackedCardT card) {
+    zobrist ^= zobrist_key(TAB_SLOT + number, tableau[number].size(), card);
+    pile_changed(number, zobrist_key(TAB_SLOT, tableau[number].size(), card));
+    tab_top_changed(number, -1);
+    tableau[number].push_inplace(card);
+    tab_top_changed(number, 1);
+}
+
+/**
+ * \brief Remove the top card of a foundation and update the hash
+ * \param number The number of the foundation
+ * \return The card removed
+ */
+PackedCardT BoardT::lift_foundation(naturalNumber number) {
+    PackedCardT card = foundation[number].top_ref();
+    found_top_changed(number, -1);
+    foundation[number].pop_inplace();
+    found_top_changed(number, 1);
+    zobrist ^= zobrist_key(FOUND_SLOT + number, foundation[number].size(), card);
+    pile_changed(TAB_SIZE + number, zobrist_key(FOUND_SLOT, foundation[number].size(), card));
+    return card;
+}
+
+/**
+ * \brief Put a card on top of a foundation and update the hash
+ * \param number The number of the foundation
+ * \param card The card being put
+ */
+void BoardT::drop_foundation(naturalNumber number, PackedCardT card) {
+    zobrist ^= zobrist_key(FOUND_SLOT + number, foundation[number].size(), card);
+    pile_changed(TAB_SIZE + number, zobrist_key(FOUND_SLOT, foundation[number].size(), card));
+    found_top_changed(number, -1);
+    foundation[number].push_inplace(card);
+    found_top_changed(number, 1);
+}
+
+/**
+ * \brief Remove the top card of the deck and update the hash
+ * \return The card removed
+ */
+PackedCardT BoardT::lift_deck() {
+    PackedCardT card = deck.top_ref();
+    deck.pop_inplace();
+    uint64_t key = zobrist_key(DECK_SLOT, deck.size(), card);
+    zobrist ^= key;
+    canon -= key;
+    return card;
+}
+
+/**
+ * \brief Put a card on top of the deck and update the hash
+ * \param card The card being put
+ */
+void BoardT::drop_deck(PackedCardT card) {
+    uint64_t key = zobrist_key(DECK_SLOT, deck.size(), card);
+    zobrist ^= key;
+    canon += key;
+    deck.push_inplace(card);
+}
+
+/**
+ * \brief Remove the top card of the waste and update the hash
+ * \return The card removed
+ */
+PackedCardT BoardT::lift_waste() {
+    PackedCardT card = waste.top_ref();
+    waste_top_changed(-1);
+    waste.pop_inplace();
+    waste_top_changed(1);
+    uint64_t key = zobrist_key(WASTE_SLOT, waste.size(), card);
+    zobrist ^= key;
+    canon -= key;
+    return card;
+}
+
+/**
+ * \brief Put a card on top of the waste and update the hash
+ * \param card The card being put
+ */
+void BoardT::drop_waste(PackedCardT card) {
+    uint64_t key = zobrist_key(WASTE_SLOT, waste.size(), card);
+    zobrist ^= key;
+    canon += key;
+    waste_top_changed(-1);
+    waste.push_inplace(card);
+    waste_top_changed(1);
+}
+
+/**
+ * \brief Add 1 to or remove 1 from the count of a card in a bit-sliced counter
+ * \details Branch-free, so the unpredictable carries cost no mispredictions.
+ * \tparam BITS Number of slices
+ * \param slices The counter, bit k of the count of a card being its bit in slices[k]
+ * \param bit Bit of the card
+ * \param delta -1 to remove, 1 to add
+ * \return Mask of the cards counted at least once
+ */
+template <int BITS>
+static uint64_t count_card(uint64_t *slices, uint64_t bit, int delta) {
+    //A slice holding the bit stops the carry of an add, one without it the borrow of a remove
+    uint64_t stopper = delta > 0 ? 0 : ~0ULL;
+    uint64_t carry = bit;
+    uint64_t counted = 0;
+    for (int k = 0; k < BITS; k++) {
+        uint64_t next = (slices[k] ^ stopper) & carry;
+        slices[k] ^= carry;
+        carry = next;
+        counted |= slices[k];
+    }
+    return counted;
+}
+
+/**
+ * \brief Set up the move summary of a board with empty piles
+ */
+void BoardT::init_summary() {
+    for (int k = 0; k < EXPOSED_BITS; k++)
+        exposed[k] = 0;
+    for (int k = 0; k < WANTED_BITS; k++)
+        wanted[k] = 0;
+    exposedMask = 0;
+    wantedMask = 0;
+    emptyTabs = TAB_SIZE;
+    kings = 0;
+    for (int i = 0; i < 4; i++)
+        suitHeights[i][0] = suitHeights[i][1] = 0;
+    for (int i = 0; i < FOUND_SIZE; i++)
+        found_top_changed(i, 1);
+}
+
+/**
+ * \brief Add to the number of tableau and waste tops equal to a card
+ * \param card The card
+ * \param delta Amount added
+ */
+void BoardT::expose(PackedCardT card, int delta) {
+    exposedMask = count_card<EXPOSED_BITS>(exposed, 1ULL << card, delta);
+}
+
+/**
+ * \brief Add to the number of tableau and foundation tops a card can be placed on
+ * \param card The card
+ * \param delta Amount added
+ */
+void BoardT::want(PackedCardT card, int delta) {
+    wantedMask = count_card<WANTED_BITS>(wanted, 1ULL << card, delta);
+}
+
+/**
+ * \brief Add or remove the summary contribution of a tableau top
+ * \details Called with -1 before the tableau changes and with 1 after.
+ * \param number The number of the tableau
+ * \param delta -1 to remove, 1 to add
+ */
+void BoardT::tab_top_changed(naturalNumber number, int delta) {
+    if (tableau[number].size() == 0) {
+        emptyTabs += delta;
+        return;
+    }
+    PackedCardT card = tableau[number].top_ref();
+    expose(card, delta);
+    want(card - 4, delta);
+}
+
+/**
+ * \brief Add or remove the summary contribution of a foundation top
+ * \details Called with -1 before the foundation changes and with 1 after.
+ * \param number The number of the foundation
+ * \param delta -1 to remove, 1 to add
+ */
+void BoardT::found_top_changed(naturalNumber number, int delta) {
+    if (foundation[number].size() == 0) {
+        for (int s = Heart; s <= Spade; s++)
+            want(pack_card({static_cast<SuitT>(s), ACE}), delta);
+        return;
+    }
+    PackedCardT card = foundation[number].top_ref();
+    if (packed_rank(card) == KING)
+        kings += delta;
+    else
+        want(card + 4, delta);
+    //The height leaves the slot holding it, or comes into a free one
+    unsigned char *height = suitHeights[packed_suit(card)];
+    unsigned char size = foundation[number].size();
+    int slot = height[0] == (delta < 0 ? size : 0) ? 0 : 1;
+    height[slot] = delta < 0 ? 0 : size;
+}
+
+/**
+ * \brief Add or remove the summary contribution of the waste top
+ * \details Called with -1 before the waste changes and with 1 after.
+ * \param delta -1 to remove, 1 to add
+ */
+void BoardT::waste_top_changed(int delta) {
+    if (waste.size() > 0)
+        expose(waste.top_ref(), delta);
+}
+
+/**
+ * \brief Compute the Zobrist hash of the position from scratch
+ * \return Hash of the position
+ */
+uint64_t BoardT::compute_hash() const {
+    uint64_t z = 0;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        for (unsigned int j = 0; j < tableau[i].size(); j++)
+            z ^= zobrist_key(TAB_SLOT + i, j, tableau[i].data()[j]);
+    }
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        for (unsigned int j = 0; j < foundation[i].size(); j++)
+            z ^= zobrist_key(FOUND_SLOT + i, j, foundation[i].data()[j]);
+    }
+    for (unsigned int j = 0; j < deck.size(); j++)
+        z ^= zobrist_key(DECK_SLOT, j, deck.data()[j]);
+    for (unsigned int j = 0; j < waste.size(); j++)
+        z ^= zobrist_key(WASTE_SLOT, j, waste.data()[j]);
+    return z;
+}
+
+/**
+ * \brief Compute the canonical hash of the position from scratch
+ * \details A tableau or foundation is hashed with the keys of the first
+ * tableau or foundation, so its hash does not depend on its place, and the
+ * scrambled pile hashes are summed with the keys of the deck and the waste.
+ */
+void BoardT::init_canonical() {
+    canon = 0;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        pileHashes[i] = 0;
+        for (unsigned int j = 0; j < tableau[i].size(); j++)
+            pile_changed(i, zobrist_key(TAB_SLOT, j, tableau[i].data()[j]));
+    }
+    for (int i = 0; i < FOUND_SIZE; i++) {
+        pileHashes[TAB_SIZE + i] = 0;
+        for (unsigned int j = 0; j < foundation[i].size(); j++)
+            pile_changed(TAB_SIZE + i, zobrist_key(FOUND_SLOT, j, foundation[i].data()[j]));
+    }
+    for (unsigned int j = 0; j < deck.size(); j++)
+        canon += zobrist_key(DECK_SLOT, j, deck.data()[j]);
+    for (unsigned int j = 0; j < waste.size(); j++)
+        canon += zobrist_key(WASTE_SLOT, j, waste.data()[j]);
+}
+
+/**
+ * \brief Add or remove a card key to the hash of a tableau or foundation
+ * \details The scrambled pile hash is taken out of the canonical hash and
+ * put back once changed; scrambling keeps piles from cancelling each other.
+ * \param pile Index of the pile, foundations after the tableaus
+ * \param key Key of the card at its depth
+ */
+void BoardT::pile_changed(naturalNumber pile, uint64_t key) {
+    canon -= mix(pileHashes[pile]);
+    pileHashes[pile] ^= key;
+    canon += mix(pileHashes[pile]);
+}
+
+/**
+ * \brief Deal a sequence of packed cards onto an empty board
+ * \details Fills the piles directly, then computes the hash and the move
+ * summary once instead of once per card.
+ * \param cards Sequence of TOTAL_CARD packed cards
+ */
+void BoardT::deal(const PackedCardT *cards) {
+    uint64_t z = zobrist;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        for (int j = 0; j < 4; j++)
+            z ^= zobrist_key(TAB_SLOT + i, j, cards[4*i+j]);
+    }
+    for (int i = 4*TAB_SIZE; i < TOTAL_CARD; i++)
+        z ^= zobrist_key(DECK_SLOT, i - 4*TAB_SIZE, cards[i]);
+    zobrist = z;
+    init_summary();
+    for (int i = 0; i < TAB_SIZE; i++) {
+        tab_top_changed(i, -1);
+        tableau[i].assign(cards + 4*i, 4);
+        tab_top_changed(i, 1);
+    }
+    deck.assign(cards + 4*TAB_SIZE, TOTAL_CARD - 4*TAB_SIZE);
+    init_canonical();
 }
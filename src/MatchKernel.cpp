@@ -0,0 +1,191 @@
+/**
+ * \file MatchKernel.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the vectorised top-card matching kernel
+ * \details The SSE2 and AVX2 versions compare one origin against all
+ * destinations with byte compares and collect the result with movemask. SSE2
+ * is part of x86-64; AVX2 is compiled with a target attribute and only run
+ * when the processor reports it.
+ */
+//Importation
+#include "MatchKernel.h"
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MATCH_KERNEL_X86 1
+#endif
+
+/**
+ * \brief Type of an implementation of match_matrix
+ */
+typedef void (*MatchFnT)(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows);
+
+/**
+ * \brief Portable implementation, compares eight destinations per word
+ * \details The accepts are loaded as four words once per call. For each
+ * origin a word is xor-ed with the origin in every byte, the zero bytes are
+ * found exactly without carries between bytes, and their high bits are
+ * gathered into one byte by a multiply. Nothing is cleared per call, so a
+ * call with few origins stays cheap.
+ */
+static void match_scalar(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows) {
+    const uint64_t ONES = 0x0101010101010101ULL;
+    const uint64_t LOW7 = 0x7f7f7f7f7f7f7f7fULL;
+    //Destination j in byte j % 8 of word j / 8, counting from the low byte
+    uint64_t words[KERNEL_LANES / 8];
+    std::memcpy(words, accepts, sizeof(words));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for (unsigned int w = 0; w < KERNEL_LANES / 8; w++)
+        words[w] = __builtin_bswap64(words[w]);
+#endif
+    for (unsigned int i = 0; i < count; i++) {
+        uint64_t card = origins[i] * ONES;
+        uint32_t row = 0;
+        for (unsigned int w = 0; w < KERNEL_LANES / 8; w++) {
+            uint64_t diff = words[w] ^ card;
+            //High bit of each byte set when the byte is 0
+            uint64_t zero = ~(((diff & LOW7) + LOW7) | diff | LOW7);
+            row |= static_cast<uint32_t>((zero >> 7) * 0x0102040810204080ULL >> 56) << (w * 8);
+        }
+        rows[i] = row;
+    }
+}
+
+#ifdef MATCH_KERNEL_X86
+/**
+ * \brief SSE2 implementation, two 16-byte compares per origin
+ */
+static void match_sse2(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(accepts));
+    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(accepts + 16));
+    for (unsigned int i = 0; i < count; i++) {
+        __m128i card = _mm_set1_epi8(static_cast<char>(origins[i]));
+        uint32_t lowBits = _mm_movemask_epi8(_mm_cmpeq_epi8(low, card));
+        uint32_t highBits = _mm_movemask_epi8(_mm_cmpeq_epi8(high, card));
+        rows[i] = lowBits | highBits << 16;
+    }
+}
+
+/**
+ * \brief AVX2 implementation, one 32-byte compare per origin
+ */
+__attribute__((target("avx2")))
+static void match_avx2(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows) {
+    __m256i all = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(accepts));
+    for (unsigned int i = 0; i < count; i++) {
+        __m256i card = _mm256_set1_epi8(static_cast<char>(origins[i]));
+        rows[i] = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(all, card)));
+    }
+}
+#endif
+
+/**
+ * \brief Return the implementation of a kernel
+ * \param kernel The kernel, which must be supported
+ * \return The implementation
+ */
+static MatchFnT kernel_fn(KernelT kernel) {
+#ifdef MATCH_KERNEL_X86
+    if (kernel == Avx2Kernel)
+        return match_avx2;
+    if (kernel == Sse2Kernel)
+        return match_sse2;
+#endif
+    return match_scalar;
+}
+
+/**
+ * \brief Return the fastest kernel the processor supports
+ * \return The kernel
+ */
+static KernelT best_kernel() {
+    if (match_kernel_supported(Avx2Kernel))
+        return Avx2Kernel;
+    if (match_kernel_supported(Sse2Kernel))
+        return Sse2Kernel;
+    return ScalarKernel;
+}
+
+static void match_first(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows);
+
+//Kernel run by match_matrix. Both are constant-initialised, so match_matrix
+//works during static initialisation; the first call picks the best kernel.
+static std::atomic<KernelT> selected(ScalarKernel);
+static std::atomic<MatchFnT> selectedFn(match_first);
+
+/**
+ * \brief Select the fastest kernel the processor supports
+ */
+static void select_best() {
+    KernelT kernel = best_kernel();
+    selected.store(kernel, std::memory_order_relaxed);
+    selectedFn.store(kernel_fn(kernel), std::memory_order_relaxed);
+}
+
+/**
+ * \brief Implementation run before a kernel is selected, selects one and runs it
+ */
+static void match_first(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows) {
+    select_best();
+    match_matrix(origins, count, accepts, rows);
+}
+
+/**
+ * \brief Compute which destinations accept which origins
+ * \details Bit j of rows[i] is set when accepts[j] equals origins[i]. A
+ * destination accepting no card should hold 0, which is never a card. Runs
+ * the kernel picked by set_match_kernel, by default the fastest one the
+ * processor supports.
+ * \param origins The cards being moved, 0 for none
+ * \param count Number of origins, at most KERNEL_ORIGINS
+ * \param accepts For each of the KERNEL_LANES destinations, the card it accepts
+ * \param rows Buffer of count rows the matrix is written to
+ */
+void match_matrix(const PackedCardT *origins, unsigned int count, const PackedCardT *accepts, uint32_t *rows) {
+    selectedFn.load(std::memory_order_relaxed)(origins, count, accepts, rows);
+}
+
+/**
+ * \brief Check if the processor can run an implementation of the kernel
+ * \param kernel The implementation
+ * \return True if it can, false otherwise
+ */
+bool match_kernel_supported(KernelT kernel) {
+    if (kernel == ScalarKernel)
+        return true;
+#ifdef MATCH_KERNEL_X86
+    __builtin_cpu_init();
+    if (kernel == Sse2Kernel)
+        return __builtin_cpu_supports("sse2");
+    if (kernel == Avx2Kernel)
+        return __builtin_cpu_supports("avx2");
+#endif
+    return false;
+}
+
+/**
+ * \brief Return the implementation match_matrix runs
+ * \return The implementation
+ */
+KernelT match_kernel() {
+    if (selectedFn.load(std::memory_order_relaxed) == match_first)
+        select_best();
+    return selected.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Choose the implementation match_matrix runs
+ * \details For testing and benchmarking; every implementation gives the same rows.
+ * \param kernel The implementation
+ * \throws invalid_argument The processor cannot run the implementation
+ */
+void set_match_kernel(KernelT kernel) {
+    if (!match_kernel_supported(kernel))
+        throw std::invalid_argument("");
+    selected.store(kernel, std::memory_order_relaxed);
+    selectedFn.store(kernel_fn(kernel), std::memory_order_relaxed);
+}
@@ -0,0 +1,304 @@
+/**
+ * \file ParallelSolver.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the multithreaded work-stealing solver
+ */
+//Importation
+#include "ParallelSolver.h"
+#include <chrono>
+#include <thread>
+
+/**
+ * \brief Number of nodes a thread searches between updates of the shared node count
+ */
+#define NODE_BATCH 1024
+
+/**
+ * \brief Constructor method for the class
+ * \param threads Number of threads searching, 0 for one per hardware thread
+ * \param maxNodes Most moves made by one search before giving up, 0 for no limit
+ * \param tableMegabytes Size of the transposition table in front of the set of reached positions
+ */
+ParallelSolverT::ParallelSolverT(unsigned int threads, unsigned long long maxNodes,
+                                 unsigned int tableMegabytes)
+    : threads(threads), maxNodes(maxNodes), cache(tableMegabytes) {
+    if (this->threads == 0)
+        this->threads = std::thread::hardware_concurrency();
+    if (this->threads == 0)
+        this->threads = 1;
+}
+
+/**
+ * \brief Search a position for a win
+ * \param start The position searched from
+ * \return Result of the search
+ */
+SolveResultT ParallelSolverT::solve(BoardT start) {
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    //Reset the shared state
+    workers.clear();
+    for (unsigned int i = 0; i < threads; i++) {
+        workers.push_back(std::unique_ptr<WorkerT>(new WorkerT()));
+        workers.back()->queued = 0;
+    }
+    for (unsigned int i = 0; i < SEEN_SHARDS; i++)
+        seen[i].clear();
+    cache.clear();
+    pending = 0;
+    idle = 0;
+    stop = false;
+    limitHit = false;
+    nodes = 0;
+    result.status = Unsolvable;
+    result.moves.clear();
+    //Search from the start position
+    TaskT root;
+    root.board = start;
+    give(0, root);
+    std::vector<std::thread> pool;
+    for (unsigned int i = 1; i < threads; i++)
+        pool.push_back(std::thread(&ParallelSolverT::work, this, i));
+    work(0);
+    for (unsigned int i = 0; i < pool.size(); i++)
+        pool[i].join();
+    if (result.status != Solved && limitHit)
+        result.status = Unknown;
+    result.nodes = nodes;
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    result.seconds = elapsed.count();
+    return result;
+}
+
+/**
+ * \brief Search a deal for a win
+ * \param cards Sequence of cards, dealt as by the BoardT constructor
+ * \return Result of the search
+ * \throws invalid_argument invalid argument exception when the cards given is not exactly two deck.
+ */
+SolveResultT ParallelSolverT::solve(std::vector<CardT> cards) {
+    return solve(BoardT(cards));
+}
+
+/**
+ * \brief Record a position as reached
+ * \details A position found in the table is in the set already. Entries are
+ * stored with the distance from the start subtracted from the largest depth,
+ * so the table keeps the positions nearest the start, which root the largest
+ * subtrees.
+ * \param hash Canonical hash of the position
+ * \param depth Number of moves from the start position
+ * \return True if no thread reached it before, false otherwise
+ */
+bool ParallelSolverT::mark_seen(uint64_t hash, unsigned int depth) {
+    TransEntryT entry;
+    if (cache.probe(hash, entry))
+        return false;
+    unsigned int shard = hash >> 58;
+    bool added;
+    {
+        std::lock_guard<std::mutex> guard(seenLock[shard]);
+        added = seen[shard].insert(hash).second;
+    }
+    entry.depth = depth < TRANS_MAX_DEPTH ? TRANS_MAX_DEPTH - depth : 0;
+    entry.bound = ExactBound;
+    entry.value = 0;
+    entry.best = MoveT();
+    cache.store(hash, entry);
+    return added;
+}
+
+/**
+ * \brief Add a task to the back of a thread's queue
+ * \param id The thread
+ * \param task The task, moved from
+ */
+void ParallelSolverT::give(unsigned int id, TaskT &task) {
+    pending++;
+    {
+        std::lock_guard<std::mutex> guard(workers[id]->lock);
+        workers[id]->tasks.push_back(std::move(task));
+        workers[id]->queued++;
+    }
+    //Taking the lock orders the push before the check of a thread going to sleep
+    std::lock_guard<std::mutex> guard(idleLock);
+    wake.notify_one();
+}
+
+/**
+ * \brief Take a task from the back of the own queue, or steal one from the front of another
+ * \param id The thread taking
+ * \param task Set to the task taken
+ * \return True if a task was taken, false otherwise
+ */
+bool ParallelSolverT::take(unsigned int id, TaskT &task) {
+    for (unsigned int i = 0; i < threads; i++) {
+        WorkerT &worker = *workers[(id + i) % threads];
+        if (worker.queued == 0)
+            continue;
+        std::lock_guard<std::mutex> guard(worker.lock);
+        if (worker.tasks.empty())
+            continue;
+        if (i == 0) {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+        }
+        else {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+        }
+        worker.queued--;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * \brief Check if any thread has a task queued
+ * \return True if one has, false otherwise
+ */
+bool ParallelSolverT::has_tasks() {
+    for (unsigned int i = 0; i < threads; i++) {
+        if (workers[i]->queued > 0)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * \brief Wake every sleeping thread, once the search stopped or no task is left
+ */
+void ParallelSolverT::wake_all() {
+    std::lock_guard<std::mutex> guard(idleLock);
+    wake.notify_all();
+}
+
+/**
+ * \brief Main loop of a thread: run tasks until none are left or the search stops
+ * \details A thread finding no task sleeps until one is given, every task is
+ * done or the search stops. Sleeping threads count as idle, so busy threads
+ * hand work over to them.
+ * \param id The thread
+ */
+void ParallelSolverT::work(unsigned int id) {
+    TaskT task;
+    while (!stop) {
+        if (take(id, task)) {
+            search(id, task);
+            if (--pending == 0 || stop)
+                wake_all();
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(idleLock);
+        if (pending == 0)
+            break;
+        idle++;
+        wake.wait(guard, [this]() { return stop || pending == 0 || has_tasks(); });
+        idle--;
+    }
+}
+
+/**
+ * \brief Depth-first search of one task
+ * \param id The thread searching
+ * \param task The task
+ */
+void ParallelSolverT::search(unsigned int id, TaskT &task) {
+    if (!mark_seen(task.board.canonical_hash(), task.prefix.size()))
+        return;
+    if (task.board.is_win_state()) {
+        std::lock_guard<std::mutex> guard(resultLock);
+        if (result.status != Solved) {
+            result.status = Solved;
+            result.moves = task.prefix;
+        }
+        stop = true;
+        return;
+    }
+    BoardT board = task.board;
+    std::vector<FrameT> frames(1);
+    std::vector<MoveT> line;
+    frames[0].count = order_moves(board, frames[0].moves, board.generate_moves(frames[0].moves));
+    frames[0].next = 0;
+    unsigned long long local = 0;
+    while (!frames.empty() && !stop) {
+        //Publish the node count and check the node limit
+        if (local == NODE_BATCH) {
+            unsigned long long total = nodes += local;
+            local = 0;
+            if (maxNodes != 0 && total >= maxNodes) {
+                limitHit = true;
+                stop = true;
+                break;
+            }
+        }
+        //Hand work over to idle threads
+        if (idle > 0 && workers[id]->queued == 0)
+            donate(id, task, board, frames, line);
+        FrameT &frame = frames.back();
+        //Every move of this depth is searched, go back up
+        if (frame.next == frame.count) {
+            frames.pop_back();
+            if (!line.empty()) {
+                board.unmake(line.back());
+                line.pop_back();
+            }
+            continue;
+        }
+        MoveT move = frame.moves[frame.next++];
+        board.make(move);
+        local++;
+        if (!mark_seen(board.canonical_hash(), task.prefix.size() + line.size() + 1)) {
+            board.unmake(move);
+            continue;
+        }
+        line.push_back(move);
+        if (board.is_win_state()) {
+            std::lock_guard<std::mutex> guard(resultLock);
+            if (result.status != Solved) {
+                result.status = Solved;
+                result.moves = task.prefix;
+                result.moves.insert(result.moves.end(), line.begin(), line.end());
+            }
+            stop = true;
+            break;
+        }
+        frames.resize(frames.size() + 1);
+        FrameT &child = frames.back();
+        child.count = order_moves(board, child.moves, board.generate_moves(child.moves));
+        child.next = 0;
+    }
+    nodes += local;
+}
+
+/**
+ * \brief Turn the untried moves of the shallowest search depth into tasks
+ * \param id The thread donating
+ * \param task The task being searched
+ * \param board The current position of the search
+ * \param frames The search depths
+ * \param line The moves from the task position to the current position
+ */
+void ParallelSolverT::donate(unsigned int id, TaskT &task, BoardT &board,
+                             std::vector<FrameT> &frames, std::vector<MoveT> &line) {
+    unsigned int depth = 0;
+    while (depth < frames.size() && frames[depth].next == frames[depth].count)
+        depth++;
+    if (depth == frames.size())
+        return;
+    //Position of that depth
+    BoardT base = board;
+    for (unsigned int i = line.size(); i > depth; i--)
+        base.unmake(line[i-1]);
+    FrameT &frame = frames[depth];
+    for (; frame.next < frame.count; frame.next++) {
+        TaskT child;
+        child.board = base;
+        child.board.make(frame.moves[frame.next]);
+        child.prefix = task.prefix;
+        child.prefix.insert(child.prefix.end(), line.begin(), line.begin() + depth);
+        child.prefix.push_back(frame.moves[frame.next]);
+        give(id, child);
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * \file Perft.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of perft, the count of move sequences of a given length
+ */
+//Importation
+#include "Perft.h"
+
+/**
+ * \brief Visit the positions reachable from a position, for perft_distinct
+ * \param board The position visited
+ * \param depth Moves left
+ * \param canonical Whether positions are told apart by canonical hash
+ * \param seen Most moves left each position was visited with
+ */
+static void visit_distinct(BoardT &board, unsigned int depth, bool canonical,
+                           std::unordered_map<uint64_t, unsigned int> &seen) {
+    uint64_t key = canonical ? board.canonical_hash() : board.hash();
+    std::pair<std::unordered_map<uint64_t, unsigned int>::iterator, bool> entry = seen.insert(std::make_pair(key, depth));
+    if (!entry.second) {
+        if (entry.first->second >= depth)
+            return;
+        entry.first->second = depth;
+    }
+    if (depth == 0)
+        return;
+    MoveT moves[MAX_MOVES];
+    unsigned int count = board.generate_moves(moves);
+    for (unsigned int i = 0; i < count; i++) {
+        board.make(moves[i]);
+        visit_distinct(board, depth - 1, canonical, seen);
+        board.unmake(moves[i]);
+    }
+}
+
+/**
+ * \brief Count the leaves of the move tree of a position
+ * \details A leaf is a sequence of exactly depth valid moves, or a shorter one
+ * ending in a position with no valid move. Uses generate_moves and make/unmake;
+ * the board is left as it was.
+ * \param board The position counted from
+ * \param depth Number of moves in a sequence
+ * \return Number of leaves
+ */
+uint64_t perft(BoardT &board, unsigned int depth) {
+    if (depth == 0)
+        return 1;
+    MoveT moves[MAX_MOVES];
+    unsigned int count = board.generate_moves(moves);
+    if (count == 0)
+        return 1;
+    //Every move of the last level is a leaf, so none of them is made
+    if (depth == 1)
+        return count;
+    uint64_t nodes = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        board.make(moves[i]);
+        nodes += perft(board, depth - 1);
+        board.unmake(moves[i]);
+    }
+    return nodes;
+}
+
+/**
+ * \brief Count the leaves of the move tree of a position the slow way
+ * \details Same count as perft, but moves are found by trying every location
+ * with is_valid_tab_mv, is_valid_waste_mv and is_valid_deck_mv and made with
+ * tab_mv, waste_mv and deck_mv on a copy of the board. Used to check perft.
+ * \param board The position counted from
+ * \param depth Number of moves in a sequence
+ * \return Number of leaves
+ */
+uint64_t perft_reference(const BoardT &board, unsigned int depth) {
+    if (depth == 0)
+        return 1;
+    BoardT position = board;
+    uint64_t nodes = 0;
+    bool moved = false;
+    CategoryT categories[2] = {Tableau, Foundation};
+    naturalNumber sizes[2] = {TAB_SIZE, FOUND_SIZE};
+    for (int c = 0; c < 2; c++) {
+        for (naturalNumber j = 0; j < sizes[c]; j++) {
+            for (naturalNumber i = 0; i < TAB_SIZE; i++) {
+                if (!position.is_valid_tab_mv(categories[c], i, j))
+                    continue;
+                BoardT next = position;
+                next.tab_mv(categories[c], i, j);
+                nodes += perft_reference(next, depth - 1);
+                moved = true;
+            }
+            if (!position.view_waste().empty() && position.is_valid_waste_mv(categories[c], j)) {
+                BoardT next = position;
+                next.waste_mv(categories[c], j);
+                nodes += perft_reference(next, depth - 1);
+                moved = true;
+            }
+        }
+    }
+    if (position.is_valid_deck_mv()) {
+        BoardT next = position;
+        next.deck_mv();
+        nodes += perft_reference(next, depth - 1);
+        moved = true;
+    }
+    return moved ? nodes : 1;
+}
+
+/**
+ * \brief Count the leaves of the move tree below each root move
+ * \param board The position counted from
+ * \param depth Number of moves in a sequence, at least 1
+ * \return One entry per valid move of the position, in generate_moves order
+ */
+std::vector<DivideT> perft_divide(BoardT &board, unsigned int depth) {
+    MoveT moves[MAX_MOVES];
+    unsigned int count = board.generate_moves(moves);
+    std::vector<DivideT> divide(count);
+    for (unsigned int i = 0; i < count; i++) {
+        board.make(moves[i]);
+        divide[i].move = moves[i];
+        divide[i].nodes = depth > 0 ? perft(board, depth - 1) : 1;
+        board.unmake(moves[i]);
+    }
+    return divide;
+}
+
+/**
+ * \brief Count the distinct positions reachable from a position
+ * \details Positions are told apart by hash, or by canonical_hash if canonical is
+ * set, so boards differing only in the order of their tableaus or foundations
+ * are counted once. A position already seen is searched again only if it is
+ * reached with more moves left. The board is left as it was.
+ * \param board The position counted from
+ * \param depth Most moves made to reach a position
+ * \param canonical Whether to count positions in canonical form
+ * \return Number of distinct positions, the start position included
+ */
+uint64_t perft_distinct(BoardT &board, unsigned int depth, bool canonical) {
+    std::unordered_map<uint64_t, unsigned int> seen;
+    visit_distinct(board, depth, canonical, seen);
+    return seen.size();
+}
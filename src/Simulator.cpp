@@ -0,0 +1,160 @@
+/**
+ * \file Simulator.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the Monte Carlo win-rate estimator
+ */
+//Importation
+#include "Simulator.h"
+#include "DeadEnd.h"
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+//Number of moves between two dead end checks of a playout; a check costs
+//about two moves, and most lost playouts go on for hundreds of moves
+#define DEAD_END_INTERVAL 16
+
+/**
+ * \brief Constructor method for the class
+ * \param policy How playouts pick their moves
+ * \param threads Number of threads playing, 0 for one per hardware thread
+ * \param maxMoves Most moves of one playout, a game still going then is lost
+ * \param pruneDeadEnds Whether a playout stops as lost once is_dead_end proves it
+ */
+SimulatorT::SimulatorT(PolicyT policy, unsigned int threads, unsigned int maxMoves, bool pruneDeadEnds)
+    : policy(policy), threads(threads), maxMoves(maxMoves), pruneDeadEnds(pruneDeadEnds) {
+    if (this->threads == 0)
+        this->threads = std::thread::hardware_concurrency();
+    if (this->threads == 0)
+        this->threads = 1;
+}
+
+/**
+ * \brief Play a batch of random deals
+ * \details The same seed gives the same result on any number of threads.
+ * \param games Number of games played
+ * \param seed Seed of the random deals and moves
+ * \return Result of the batch
+ */
+SimulationResultT SimulatorT::run(unsigned long long games, uint64_t seed) {
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::vector<unsigned long long> wins(threads, 0);
+    std::vector<unsigned long long> moves(threads, 0);
+    std::vector<std::thread> pool;
+    for (unsigned int t = 0; t < threads; t++) {
+        pool.push_back(std::thread([this, &wins, &moves, games, seed, t]() {
+            unsigned long long won = 0;
+            unsigned long long made = 0;
+            for (unsigned long long i = t; i < games; i += threads) {
+                BoardT board = deal_board(seed + i);
+                DealRngT random(~(seed + i));
+                won += play(board, random, made);
+            }
+            wins[t] = won;
+            moves[t] = made;
+        }));
+    }
+    for (unsigned int t = 0; t < threads; t++)
+        pool[t].join();
+    //Add up the counters and compute the Wilson interval
+    SimulationResultT result;
+    result.games = games;
+    result.wins = 0;
+    result.moves = 0;
+    for (unsigned int t = 0; t < threads; t++) {
+        result.wins += wins[t];
+        result.moves += moves[t];
+    }
+    double n = games;
+    double p = games > 0 ? result.wins / n : 0;
+    double z = 1.96;
+    double centre = games > 0 ? (p + z * z / (2 * n)) / (1 + z * z / n) : 0;
+    double spread = games > 0 ? z * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) / (1 + z * z / n) : 0;
+    result.winRate = p;
+    result.low = games > 0 ? centre - spread : 0;
+    result.high = games > 0 ? centre + spread : 1;
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    result.seconds = elapsed.count();
+    return result;
+}
+
+/**
+ * \brief Play one game out from a position
+ * \details If pruneDeadEnds is set, every few moves the position is
+ * checked with is_dead_end and a game proven lost stops there. The outcome is
+ * the same as playing on, so results do not change, only the board left.
+ * \param board The position, played in place
+ * \param random Random number generator the moves are drawn from
+ * \return True if the game was won, false otherwise
+ */
+bool SimulatorT::play(BoardT &board, DealRngT &random) {
+    unsigned long long moves = 0;
+    return play(board, random, moves);
+}
+
+/**
+ * \brief Play one game out from a position and count the moves made
+ * \details As play(board, random); a game stopped as a dead end counts only
+ * the moves made before the stop.
+ * \param board The position, played in place
+ * \param random Random number generator the moves are drawn from
+ * \param made Increased by the number of moves made
+ * \return True if the game was won, false otherwise
+ */
+bool SimulatorT::play(BoardT &board, DealRngT &random, unsigned long long &made) {
+    MoveT moves[MAX_MOVES];
+    MoveT preferred[MAX_MOVES];
+    MoveT last = deck_move();
+    for (unsigned int step = 0; step < maxMoves; step++) {
+        if (board.is_win_state())
+            return true;
+        unsigned int count = board.generate_moves(moves);
+        if (count == 0)
+            return false;
+        if (pruneDeadEnds && step % DEAD_END_INTERVAL == 0 && is_dead_end(board))
+            return false;
+        made++;
+        if (policy == RandomPolicy) {
+            board.make(moves[random.bounded(count)]);
+            continue;
+        }
+        //Foundation moves first
+        unsigned int n = 0;
+        for (unsigned int i = 0; i < count; i++) {
+            if (moves[i].category == Foundation)
+                preferred[n++] = moves[i];
+        }
+        //Then building on a tableau, from the waste before the tableau, never
+        //straight back where the card came from. Every candidate of the first
+        //group that has one is kept, and one is drawn at random
+        if (n == 0) {
+            for (unsigned int i = 0; i < count; i++) {
+                if (moves[i].origin_category == Waste && moves[i].category == Tableau
+                        && board.get_tab_size(moves[i].destination) > 0)
+                    preferred[n++] = moves[i];
+            }
+        }
+        if (n == 0) {
+            for (unsigned int i = 0; i < count; i++) {
+                if (moves[i].origin_category == Tableau && moves[i].category == Tableau
+                        && board.get_tab_size(moves[i].destination) > 0
+                        && !(last.origin_category == Tableau && last.category == Tableau
+                             && moves[i].origin == last.destination && moves[i].destination == last.origin))
+                    preferred[n++] = moves[i];
+            }
+        }
+        //Then the deck, then anything left
+        if (n == 0 && moves[count-1].origin_category == Deck)
+            preferred[n++] = moves[count-1];
+        if (n == 0) {
+            for (unsigned int i = 0; i < count; i++)
+                preferred[n++] = moves[i];
+        }
+        last = preferred[random.bounded(n)];
+        board.make(last);
+    }
+    return board.is_win_state();
+}
@@ -0,0 +1,136 @@
+/**
+ * \file Solver.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the depth-first solver
+ */
+//Importation
+#include "Solver.h"
+#include "DeadEnd.h"
+#include <chrono>
+
+/**
+ * \brief Put the moves worth searching first and drop useless ones
+ * \details Foundation moves come first and the deck move last. Moving the
+ * only card of a tableau to an empty tableau is dropped, since it leads to
+ * the same position with two piles swapped. Every move of a position
+ * is_dead_end proves lost is dropped, so searches back out of it at once.
+ * If a move is_safe_mv, it is kept alone, since it is as good as any other.
+ * \param board The position the moves were generated for
+ * \param moves The moves, reordered in place
+ * \param count Number of moves
+ * \return Number of moves kept
+ */
+unsigned int order_moves(BoardT &board, MoveT *moves, unsigned int count) {
+    if (is_dead_end(board))
+        return 0;
+    for (unsigned int i = 0; i < count; i++) {
+        if (board.is_safe_mv(moves[i])) {
+            moves[0] = moves[i];
+            return 1;
+        }
+    }
+    MoveT ordered[MAX_MOVES];
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        if (moves[i].category == Foundation)
+            ordered[n++] = moves[i];
+    }
+    for (unsigned int i = 0; i < count; i++) {
+        MoveT m = moves[i];
+        if (m.category != Tableau)
+            continue;
+        if (m.origin_category == Tableau && board.get_tab_size(m.origin) == 1
+                && board.get_tab_size(m.destination) == 0)
+            continue;
+        ordered[n++] = m;
+    }
+    for (unsigned int i = 0; i < count; i++) {
+        if (moves[i].origin_category == Deck)
+            ordered[n++] = moves[i];
+    }
+    for (unsigned int i = 0; i < n; i++)
+        moves[i] = ordered[i];
+    return n;
+}
+
+/**
+ * \brief Constructor method for the class
+ * \param maxNodes Most moves made by one search before giving up, 0 for no limit
+ */
+SolverT::SolverT(unsigned long long maxNodes) : maxNodes(maxNodes) {}
+
+/**
+ * \brief Search a position for a win
+ * \param start The position searched from
+ * \return Result of the search
+ */
+SolveResultT SolverT::solve(BoardT start) {
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    SolveResultT result;
+    result.status = Unsolvable;
+    result.nodes = 0;
+    board = start;
+    seen.clear();
+    frames.clear();
+    line.clear();
+    seen.insert(board.canonical_hash());
+    if (board.is_win_state())
+        result.status = Solved;
+    else
+        push_frame();
+    while (!frames.empty()) {
+        if (maxNodes != 0 && result.nodes >= maxNodes) {
+            result.status = Unknown;
+            break;
+        }
+        FrameT &frame = frames.back();
+        //Every move of this depth is searched, go back up
+        if (frame.next == frame.count) {
+            frames.pop_back();
+            if (!line.empty()) {
+                board.unmake(line.back());
+                line.pop_back();
+            }
+            continue;
+        }
+        MoveT move = frame.moves[frame.next++];
+        board.make(move);
+        result.nodes++;
+        if (!seen.insert(board.canonical_hash()).second) {
+            board.unmake(move);
+            continue;
+        }
+        line.push_back(move);
+        if (board.is_win_state()) {
+            result.status = Solved;
+            result.moves = line;
+            break;
+        }
+        push_frame();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+    result.seconds = elapsed.count();
+    return result;
+}
+
+/**
+ * \brief Search a deal for a win
+ * \param cards Sequence of cards, dealt as by the BoardT constructor
+ * \return Result of the search
+ * \throws invalid_argument invalid argument exception when the cards given is not exactly two deck.
+ */
+SolveResultT SolverT::solve(std::vector<CardT> cards) {
+    return solve(BoardT(cards));
+}
+
+/**
+ * \brief Add a frame holding the ordered moves of the current position
+ */
+void SolverT::push_frame() {
+    frames.resize(frames.size() + 1);
+    FrameT &frame = frames.back();
+    frame.count = order_moves(board, frame.moves, board.generate_moves(frame.moves));
+    frame.next = 0;
+}
@@ -2,7 +2,7 @@
  * \file Stack.cpp
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/09
- * \date Last modified 2019/03/18
+ * \date Last modified 2026/10/17
  * \brief Implimentation of the generic stack
  */
 //Importation
@@ -35,9 +35,8 @@ Stack<T>::Stack(std::vector<T> stack) {
  */
 template <class T>
 Stack<T> Stack<T>::push(T element) {
-    stack.push_back(element);
-    Stack<T> newStack = *(new Stack(stack));
-    stack.pop_back();
+    Stack<T> newStack(stack);
+    newStack.push_inplace(element);
     return newStack;
 }
 
@@ -51,10 +50,8 @@ Stack<T> Stack<T>::pop() {
     if (size() == 0) {
         throw std::out_of_range("");
     }
-    T element = top();
-    stack.pop_back();
-    Stack<T> newStack = *(new Stack(stack));
-    stack.push_back(element);
+    Stack<T> newStack(stack);
+    newStack.pop_inplace();
     return newStack;
 }
 
@@ -89,5 +86,42 @@ std::vector<T> Stack<T>::toSeq() {
     return stack;
 }
 
+/**
+ * \brief Add a element to the top of this stack in place.
+ * \details Unlike push, no new Stack object is created.
+ * \param element Element being added
+ */
+template <class T>
+void Stack<T>::push_inplace(T element) {
+    stack.push_back(element);
+}
+
+/**
+ * \brief Remove the top-most element of this stack in place.
+ * \details Unlike pop, no new Stack object is created.
+ * \throw out_of_range out of range exception when stack is empty
+ */
+template <class T>
+void Stack<T>::pop_inplace() {
+    if (size() == 0) {
+        throw std::out_of_range("");
+    }
+    stack.pop_back();
+}
+
+/**
+ * \brief Returns a reference to the element on the top of stack
+ * \details The reference is invalidated by the next push_inplace or pop_inplace.
+ * \return Reference to the element on the top of stack
+ * \throw out_of_range out of range exception when stack is empty
+ */
+template <class T>
+const T &Stack<T>::top_ref() {
+    if (size() == 0) {
+        throw std::out_of_range("");
+    }
+    return stack.back();
+}
+
 // Keep this at bottom
 template class Stack<CardT>;
@@ -0,0 +1,208 @@
+/**
+ * \file TransTable.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Implimentation of the transposition table
+ */
+//Importation
+#include "TransTable.h"
+#include <new>
+#include <cstdlib>
+#include <thread>
+
+/**
+ * \brief Data of a slot claimed by a writer, never a packed entry since bit 63 is clear
+ */
+#define BUSY 1
+
+/**
+ * \brief Pack an entry into 64 bits
+ * \details Bits 0-31 hold the move, 32-47 the value, 48-49 the bound, 50-62
+ * the depth and bit 63 is always set, so a used slot is never all zero.
+ * \param entry The entry
+ * \return The packed entry
+ */
+static uint64_t pack_entry(TransEntryT entry) {
+    uint64_t depth = entry.depth > TRANS_MAX_DEPTH ? TRANS_MAX_DEPTH : entry.depth;
+    return (uint64_t)entry.best.origin_category
+        | (uint64_t)entry.best.origin << 8
+        | (uint64_t)entry.best.category << 16
+        | (uint64_t)entry.best.destination << 24
+        | (uint64_t)(unsigned short)entry.value << 32
+        | (uint64_t)entry.bound << 48
+        | depth << 50
+        | (uint64_t)1 << 63;
+}
+
+/**
+ * \brief Unpack an entry packed by pack_entry
+ * \param data The packed entry
+ * \return The entry
+ */
+static TransEntryT unpack_entry(uint64_t data) {
+    TransEntryT entry;
+    entry.best.origin_category = data & 0xFF;
+    entry.best.origin = (data >> 8) & 0xFF;
+    entry.best.category = (data >> 16) & 0xFF;
+    entry.best.destination = (data >> 24) & 0xFF;
+    entry.value = (short)((data >> 32) & 0xFFFF);
+    entry.bound = static_cast<BoundT>((data >> 48) & 3);
+    entry.depth = (data >> 50) & TRANS_MAX_DEPTH;
+    return entry;
+}
+
+/**
+ * \brief Constructor method for the class
+ * \param megabytes Size of the table, rounded down to a power of two buckets
+ * \param policy Replacement policy used by store
+ */
+TransTableT::TransTableT(unsigned int megabytes, ReplacementT policy) : policy(policy) {
+    uint64_t count = 1;
+    while (count * 2 * sizeof(BucketT) <= (uint64_t)megabytes << 20)
+        count *= 2;
+    void *memory = NULL;
+    if (posix_memalign(&memory, sizeof(BucketT), count * sizeof(BucketT)) != 0)
+        throw std::bad_alloc();
+    buckets = static_cast<BucketT *>(memory);
+    for (uint64_t i = 0; i < count; i++)
+        new (&buckets[i]) BucketT();
+    mask = count - 1;
+    clear();
+}
+
+/**
+ * \brief Destructor method for the class
+ */
+TransTableT::~TransTableT() {
+    std::free(buckets);
+}
+
+/**
+ * \brief Look a position up
+ * \param key Hash of the position
+ * \param entry Set to the stored information if found
+ * \return True if found, false otherwise
+ */
+bool TransTableT::probe(uint64_t key, TransEntryT &entry) const {
+    const BucketT &bucket = buckets[key & mask];
+    for (int i = 0; i < 4; i++) {
+        uint64_t data = bucket.slots[i].data.load(std::memory_order_acquire);
+        uint64_t check = bucket.slots[i].check.load(std::memory_order_relaxed);
+        if (data != 0 && data != BUSY && (check ^ data) == key) {
+            entry = unpack_entry(data);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * \brief Store information about a position
+ * \details An entry with the same key is always overwritten, otherwise an
+ * empty slot is used, otherwise the replacement policy picks the slot. Never
+ * waits: if another writer holds a slot of the bucket, the entry is dropped.
+ * \param key Hash of the position
+ * \param entry Information being stored
+ */
+void TransTableT::store(uint64_t key, TransEntryT entry) {
+    put(key, entry, true);
+}
+
+/**
+ * \brief Store a position unless it is already stored
+ * \details Checking and storing is one atomic step, so of several threads
+ * inserting the same key at once only one gets true.
+ * \param key Hash of the position
+ * \param entry Information being stored
+ * \return True if the position was not stored before, false otherwise
+ */
+bool TransTableT::insert(uint64_t key, TransEntryT entry) {
+    return put(key, entry, false);
+}
+
+/**
+ * \brief Write an entry into the bucket of its key
+ * \details The slot is claimed by swapping its data for BUSY, then the check
+ * and the data are written. A claimed slot may be taking the same key, so
+ * when the key is not found but a slot is claimed, or when the claim fails, a
+ * store gives up, the table being a cache. An insert must answer exactly, so
+ * it yields and scans the bucket again.
+ * \param key Hash of the position
+ * \param entry Information being stored
+ * \param overwrite Whether an entry with the same key is overwritten, i.e. a store
+ * \return False if an entry with the same key was found and kept, true otherwise
+ */
+bool TransTableT::put(uint64_t key, TransEntryT entry, bool overwrite) {
+    BucketT &bucket = buckets[key & mask];
+    uint64_t data = pack_entry(entry);
+    for (;;) {
+        uint64_t old[4];
+        int target = -1;
+        int empty = -1;
+        int shallowest = -1;
+        uint64_t shallowestDepth = ~(uint64_t)0;
+        bool busy = false;
+        for (int i = 0; i < 4; i++) {
+            old[i] = bucket.slots[i].data.load(std::memory_order_acquire);
+            if (old[i] == BUSY) {
+                busy = true;
+                continue;
+            }
+            if (old[i] == 0) {
+                if (empty < 0)
+                    empty = i;
+                continue;
+            }
+            if ((bucket.slots[i].check.load(std::memory_order_relaxed) ^ old[i]) == key) {
+                target = i;
+                break;
+            }
+            if ((old[i] >> 50 & TRANS_MAX_DEPTH) < shallowestDepth) {
+                shallowestDepth = old[i] >> 50 & TRANS_MAX_DEPTH;
+                shallowest = i;
+            }
+        }
+        if (target >= 0 && !overwrite)
+            return false;
+        if (target < 0 && busy) {
+            if (overwrite)
+                return true;
+            std::this_thread::yield();
+            continue;
+        }
+        if (target < 0)
+            target = empty;
+        if (target < 0)
+            target = policy == DepthPreferred ? shallowest : (key >> 32) & 3;
+        if (!bucket.slots[target].data.compare_exchange_strong(old[target], BUSY, std::memory_order_acquire)) {
+            if (overwrite)
+                return true;
+            continue;
+        }
+        bucket.slots[target].check.store(key ^ data, std::memory_order_relaxed);
+        bucket.slots[target].data.store(data, std::memory_order_release);
+        return true;
+    }
+}
+
+/**
+ * \brief Remove every entry
+ * \details Not safe to call while other threads use the table.
+ */
+void TransTableT::clear() {
+    for (uint64_t i = 0; i <= mask; i++) {
+        for (int j = 0; j < 4; j++) {
+            buckets[i].slots[j].check.store(0, std::memory_order_relaxed);
+            buckets[i].slots[j].data.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * \brief Returns the number of entries the table can hold
+ * \return Number of slots
+ */
+uint64_t TransTableT::capacity() const {
+    return (mask + 1) * 4;
+}
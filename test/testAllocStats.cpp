@@ -0,0 +1,145 @@
+/**
+ * \file testAllocStats.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for AllocStats, and the zero-allocation paths of the engine
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "CardStack.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include "AllocStats.h"
+#include <vector>
+
+
+
+//===============================================================================================================================
+
+
+
+//Keeps the compiler from leaving out a new and delete pair
+static int *volatile sink;
+
+
+
+//Testing unit for AllocStats
+//Test for normal and boundary cases
+TEST_CASE("Tests for AllocStats", "[AllocStats]") {
+    
+    //Variables needed for testing
+    BoardT board = deal_board(7);
+    MoveT moves[MAX_MOVES];
+    unsigned int count = board.generate_moves(moves);
+    REQUIRE(count > 1);
+    
+    SECTION("AllocScopeT - normal") {
+        AllocScopeT scope;
+        int *p = new int[100];
+        sink = p;
+        AllocStatsT stats = scope.stats();
+        REQUIRE(stats.allocations == 1);
+        REQUIRE(stats.frees == 0);
+        REQUIRE(stats.bytes == 100 * sizeof(int));
+        REQUIRE(stats.liveBytes >= static_cast<long long>(100 * sizeof(int)));
+        delete[] p;
+        stats = scope.stats();
+        REQUIRE(stats.allocations == 1);
+        REQUIRE(stats.frees == 1);
+        REQUIRE(stats.liveBytes == 0);
+        REQUIRE(scope.allocations() == 1);
+    }
+    
+    SECTION("AllocScopeT - boundary") {
+        REQUIRE(!alloc_tracking());
+        {
+            AllocScopeT outer;
+            {
+                AllocScopeT inner;
+                REQUIRE(alloc_tracking());
+            }
+            REQUIRE(alloc_tracking());
+            REQUIRE(outer.allocations() == 0);
+        }
+        REQUIRE(!alloc_tracking());
+        //Nothing is counted while tracking is off
+        AllocStatsT before = alloc_stats();
+        std::vector<int> v(10);
+        REQUIRE(alloc_stats().allocations == before.allocations);
+    }
+    
+    SECTION("BoardT - moves, validation and checks allocate nothing") {
+        AllocScopeT scope;
+        for (unsigned int i = 0; i < TAB_SIZE; i++) {
+            board.check_tab_mv(Tableau, i, 0);
+            board.is_valid_tab_mv(Foundation, i, 0);
+        }
+        board.is_valid_deck_mv();
+        board.valid_mv_exists();
+        board.is_win_state();
+        board.generate_moves(moves);
+        board.view_tab(0);
+        board.hash();
+        for (unsigned int i = 0; i < count; i++) {
+            board.make(moves[i]);
+            board.unmake(moves[i]);
+        }
+        board.deck_mv();
+        if (board.is_valid_waste_mv(Foundation, 0))
+            board.waste_mv(Foundation, 0);
+        for (unsigned int i = 0; i < TAB_SIZE; i++) {
+            for (unsigned int j = 0; j < TAB_SIZE; j++) {
+                if (board.try_tab_mv(Tableau, i, j) == Legal)
+                    board.unmake(tab_move(Tableau, i, j));
+            }
+        }
+        BoardT copy = board;
+        REQUIRE(copy == board);
+        REQUIRE(scope.allocations() == 0);
+    }
+    
+    SECTION("BoardT - tab_mv allocates nothing") {
+        unsigned int made = 0;
+        for (uint64_t seed = 0; seed < 20; seed++) {
+            BoardT dealt = deal_board(seed);
+            AllocScopeT scope;
+            for (unsigned int i = 0; i < TAB_SIZE; i++) {
+                for (unsigned int j = 0; j < TAB_SIZE; j++) {
+                    if (dealt.is_valid_tab_mv(Tableau, i, j)) {
+                        dealt.tab_mv(Tableau, i, j);
+                        dealt.unmake(tab_move(Tableau, i, j));
+                        made++;
+                    }
+                }
+                if (dealt.is_valid_tab_mv(Foundation, i, 0)) {
+                    dealt.tab_mv(Foundation, i, 0);
+                    made++;
+                }
+            }
+            REQUIRE(scope.allocations() == 0);
+        }
+        REQUIRE(made > 0);
+    }
+    
+    SECTION("BoardT - construction from packed cards allocates nothing") {
+        PackedCardT packed[TOTAL_CARD];
+        deal_packed(3, packed);
+        AllocScopeT scope;
+        BoardT dealt(packed);
+        BoardT snapped(dealt.snapshot());
+        REQUIRE(scope.allocations() == 0);
+    }
+    
+    SECTION("BoardT, Stack - copying accessors allocate") {
+        AllocScopeT scope;
+        CardStackT tab = board.get_tab(0);
+        REQUIRE(scope.allocations() > 0);
+        long long before = scope.allocations();
+        CardT card = {Heart, ACE};
+        tab = tab.push(card);
+        REQUIRE(scope.allocations() > before);
+    }
+}
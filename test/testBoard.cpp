@@ -2,7 +2,7 @@
  * \file testBoard.cpp
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/18
- * \date Last modified 2019/03/22
+ * \date Last modified 2026/10/17
  * \brief Unit testing for GameBoard
  */
 //Importation
@@ -11,8 +11,13 @@
 #include "Stack.h"
 #include "CardStack.h"
 #include "GameBoard.h"
+#include "testHelpers.h"
 #include <vector>
 #include <stdexcept>
+#include <cstring>
+#include <type_traits>
+#include <random>
+#include <algorithm>
 
 
 
@@ -20,6 +25,36 @@
 
 
 
+//Every valid move of a board, found through the validation functions
+static std::vector<MoveT> legal_moves(BoardT &board) {
+    std::vector<MoveT> legal;
+    for (int i = 0; i < TAB_SIZE; i++) {
+        for (int j = 0; j < TAB_SIZE; j++) {
+            if (board.is_valid_tab_mv(Tableau, i, j))
+                legal.push_back(tab_move(Tableau, i, j));
+        }
+        for (int j = 0; j < FOUND_SIZE; j++) {
+            if (board.is_valid_tab_mv(Foundation, i, j))
+                legal.push_back(tab_move(Foundation, i, j));
+        }
+    }
+    if (board.get_waste().size() > 0) {
+        for (int j = 0; j < TAB_SIZE; j++) {
+            if (board.is_valid_waste_mv(Tableau, j))
+                legal.push_back(waste_move(Tableau, j));
+        }
+        for (int j = 0; j < FOUND_SIZE; j++) {
+            if (board.is_valid_waste_mv(Foundation, j))
+                legal.push_back(waste_move(Foundation, j));
+        }
+    }
+    if (board.is_valid_deck_mv())
+        legal.push_back(deck_move());
+    return legal;
+}
+
+
+
 //Testing unit for GameBoard
 //Test for normal, boundary and exception cases
 TEST_CASE("Tests for GameBoard", "[GameBoard]") {
@@ -62,6 +97,50 @@ TEST_CASE("Tests for GameBoard", "[GameBoard]") {
         }
     }
     
+    SECTION("view_tab, view_foundation, view_deck, view_waste - normal") {
+        board.deck_mv();
+        board.waste_mv(Foundation, 0);
+        board.deck_mv();
+        for (int i = 0; i < TAB_SIZE; i++) {
+            tempStack = board.get_tab(i).toSeq();
+            PileViewT view = board.view_tab(i);
+            REQUIRE(view.size() == tempStack.size());
+            for (unsigned int j = 0; j < view.size(); j++) {
+                REQUIRE(view[j].s == tempStack[j].s);
+                REQUIRE(view[j].r == tempStack[j].r);
+                REQUIRE(view.packed(j) == pack_card(tempStack[j]));
+            }
+            REQUIRE(view.top().r == tempStack.back().r);
+        }
+        tempStack = board.get_foundation(0).toSeq();
+        REQUIRE(board.view_foundation(0).size() == 1);
+        REQUIRE(board.view_foundation(0).top().r == tempStack[0].r);
+        REQUIRE(board.view_foundation(1).empty());
+        tempStack = board.get_deck().toSeq();
+        PileViewT deckView = board.view_deck();
+        REQUIRE(deckView.size() == 62);
+        REQUIRE(std::equal(deckView.begin(), deckView.end(), tempStack.begin(),
+                           [](PackedCardT a, CardT b) { return a == pack_card(b); }));
+        REQUIRE(board.view_waste().size() == 1);
+        REQUIRE(pack_card(board.view_waste().top()) == pack_card(board.get_waste().top()));
+    }
+    
+    SECTION("view_tab, view_foundation, view_deck, view_waste - boundary") {
+        PileViewT empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty.begin() == empty.end());
+        REQUIRE(board.view_waste().empty());
+        REQUIRE(board.view_tab(TAB_SIZE - 1).size() == 4);
+        REQUIRE(board.view_foundation(FOUND_SIZE - 1).size() == 0);
+    }
+    
+    SECTION("view_tab, view_foundation, view_deck, view_waste - exception") {
+        REQUIRE_THROWS_AS(board.view_tab(TAB_SIZE), std::out_of_range);
+        REQUIRE_THROWS_AS(board.view_foundation(FOUND_SIZE), std::out_of_range);
+        REQUIRE_THROWS_AS(board.view_waste().top(), std::out_of_range);
+        REQUIRE_THROWS_AS(board.view_tab(0).at(4), std::out_of_range);
+    }
+    
     SECTION("Constructor - exception") {
         std::vector<CardT> badDeck;
         for (RankT rank = ACE; rank <= QUEEN; rank++) {
@@ -79,6 +158,38 @@ TEST_CASE("Tests for GameBoard", "[GameBoard]") {
         REQUIRE_THROWS_AS(new BoardT(badDeck), std::invalid_argument);
     }
     
+    SECTION("Constructor from packed cards - normal") {
+        PackedCardT packed[TOTAL_CARD];
+        for (int i = 0; i < TOTAL_CARD; i++)
+            packed[i] = pack_card(deck[i]);
+        BoardT checked(packed);
+        BoardT trusted(packed, false);
+        REQUIRE(checked == board);
+        REQUIRE(trusted == board);
+        REQUIRE(checked.hash() == board.hash());
+    }
+    
+    SECTION("Constructor from packed cards - exception") {
+        PackedCardT packed[TOTAL_CARD];
+        for (int i = 0; i < TOTAL_CARD; i++)
+            packed[i] = pack_card(deck[i]);
+        packed[5] = packed[6];
+        REQUIRE_THROWS_AS(BoardT(packed), std::invalid_argument);
+        packed[5] = 0;
+        REQUIRE_THROWS_AS(BoardT(packed), std::invalid_argument);
+        packed[5] = 200;
+        REQUIRE_THROWS_AS(BoardT(packed), std::invalid_argument);
+        //Bytes that are not cards are refused even unchecked
+        REQUIRE_THROWS_AS(BoardT(packed, false), std::invalid_argument);
+        packed[5] = 0;
+        REQUIRE_THROWS_AS(BoardT(packed, false), std::invalid_argument);
+        packed[5] = pack_card({Spade, KING}) + 1;
+        REQUIRE_THROWS_AS(BoardT(packed, false), std::invalid_argument);
+        //Unchecked, a wrong count of cards is allowed
+        packed[5] = packed[6];
+        REQUIRE_NOTHROW(BoardT(packed, false));
+    }
+    
     SECTION("is_valid_tab_mv - normal") {
         REQUIRE(board.is_valid_tab_mv(Tableau, 1, 0));
         REQUIRE(!board.is_valid_tab_mv(Tableau, 0, 1));
@@ -186,10 +297,424 @@ TEST_CASE("Tests for GameBoard", "[GameBoard]") {
         REQUIRE_THROWS_AS(board.deck_mv(), std::invalid_argument);
     }
     
+    SECTION("Copy - memcpy clone") {
+        REQUIRE(std::is_trivially_copyable<BoardT>::value);
+        BoardT clone;
+        std::memcpy(&clone, &board, sizeof(BoardT));
+        board.deck_mv();
+        REQUIRE(clone.get_deck().size() == 64);
+        REQUIRE(clone.get_waste().size() == 0);
+        REQUIRE(board.get_deck().size() == 63);
+    }
+    
+    SECTION("hash and operator== - normal") {
+        BoardT other(deck);
+        REQUIRE(board == other);
+        REQUIRE(board.hash() == other.hash());
+        board.tab_mv(Tableau, 1, 0);
+        REQUIRE(!(board == other));
+        REQUIRE(board.hash() != other.hash());
+        board.deck_mv();
+        other.deck_mv();
+        other.tab_mv(Tableau, 1, 0);
+        REQUIRE(board == other);
+        REQUIRE(board.hash() == other.hash());
+    }
+    
+    SECTION("hash - same cards in different piles") {
+        BoardT other(deck);
+        board.tab_mv(Foundation, 1, 0);
+        other.tab_mv(Foundation, 1, 1);
+        REQUIRE(!(board == other));
+        REQUIRE(board.hash() != other.hash());
+    }
+    
+    SECTION("canonical and canonical_hash - same position in different piles") {
+        //Foundations swapped
+        BoardT other(deck);
+        board.tab_mv(Foundation, 1, 0);
+        other.tab_mv(Foundation, 1, 1);
+        REQUIRE(board.canonical_hash() == other.canonical_hash());
+        REQUIRE(board.canonical() == other.canonical());
+        //Tableaus swapped
+        std::vector<CardT> swapped = deck;
+        std::swap_ranges(swapped.begin(), swapped.begin() + 4, swapped.begin() + 12);
+        BoardT first(deck);
+        BoardT second(swapped);
+        REQUIRE(!(first == second));
+        REQUIRE(first.hash() != second.hash());
+        REQUIRE(first.canonical_hash() == second.canonical_hash());
+        REQUIRE(first.canonical() == second.canonical());
+        REQUIRE(first.canonical().hash() == second.canonical().hash());
+    }
+    
+    SECTION("canonical and canonical_hash - different positions") {
+        BoardT other(deck);
+        other.tab_mv(Tableau, 1, 0);
+        REQUIRE(board.canonical_hash() != other.canonical_hash());
+        REQUIRE(!(board.canonical() == other.canonical()));
+        //Cards moved from the deck to the waste
+        BoardT turned(deck);
+        turned.deck_mv();
+        REQUIRE(board.canonical_hash() != turned.canonical_hash());
+        board.deck_mv();
+        turned.deck_mv();
+        REQUIRE(board.canonical_hash() != turned.canonical_hash());
+    }
+    
+    SECTION("canonical - sorted piles, same cards") {
+        BoardT canonical = board.canonical();
+        for (int i = 1; i < TAB_SIZE; i++) {
+            PileViewT a = canonical.view_tab(i - 1);
+            PileViewT b = canonical.view_tab(i);
+            REQUIRE(!std::lexicographical_compare(b.begin(), b.end(), a.begin(), a.end()));
+        }
+        REQUIRE(canonical.canonical() == canonical);
+        REQUIRE(canonical.canonical_hash() == board.canonical_hash());
+        REQUIRE(canonical.valid_mv_exists() == board.valid_mv_exists());
+        //The canonical form is a board like any other
+        MoveT moves[MAX_MOVES];
+        MoveT canonicalMoves[MAX_MOVES];
+        REQUIRE(canonical.generate_moves(canonicalMoves) == board.generate_moves(moves));
+        REQUIRE(BoardT(canonical.snapshot()) == canonical);
+    }
+    
+    SECTION("canonical_hash - kept up to date by make and unmake") {
+        std::mt19937 rng(23);
+        MoveT moves[MAX_MOVES];
+        for (int game = 0; game < 20; game++) {
+            std::vector<CardT> shuffled = deck;
+            std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            BoardT current(shuffled);
+            uint64_t start = current.canonical_hash();
+            std::vector<MoveT> made;
+            for (int step = 0; step < 200; step++) {
+                unsigned int n = current.generate_moves(moves);
+                if (n == 0)
+                    break;
+                MoveT move = moves[rng() % n];
+                current.make(move);
+                made.push_back(move);
+                //Recomputed from scratch by the snapshot constructor
+                REQUIRE(BoardT(current.snapshot()).canonical_hash() == current.canonical_hash());
+                REQUIRE(current.canonical().canonical_hash() == current.canonical_hash());
+            }
+            while (!made.empty()) {
+                current.unmake(made.back());
+                made.pop_back();
+            }
+            REQUIRE(current.canonical_hash() == start);
+        }
+    }
+    
+    SECTION("canonical and canonical_hash - boundary") {
+        BoardT empty;
+        REQUIRE(empty.canonical_hash() == 0);
+        REQUIRE(empty.canonical() == empty);
+        REQUIRE(empty.canonical().hash() == empty.hash());
+    }
+    
+    SECTION("check_tab_mv and check_waste_mv - normal") {
+        REQUIRE(board.check_tab_mv(Tableau, 1, 0) == Legal);
+        REQUIRE(board.check_tab_mv(Tableau, 0, 1) == Illegal);
+        REQUIRE(board.check_tab_mv(Deck, 1, 0) == Illegal);
+        REQUIRE(board.check_waste_mv(Tableau, 0) == EmptyOrigin);
+        board.deck_mv();
+        REQUIRE(board.check_waste_mv(Foundation, 0) == Legal);
+        REQUIRE(board.check_waste_mv(Tableau, 1) == Illegal);
+    }
+    
+    SECTION("check_tab_mv and check_waste_mv - boundary") {
+        REQUIRE(board.check_tab_mv(Tableau, 59, 99) == BadPosition);
+        REQUIRE(board.check_tab_mv(Foundation, 0, FOUND_SIZE) == BadPosition);
+        REQUIRE(board.check_waste_mv(Tableau, 59) == BadPosition);
+        BoardT empty;
+        REQUIRE(empty.check_tab_mv(Tableau, 1, 0) == EmptyOrigin);
+    }
+    
+    SECTION("try_tab_mv, try_waste_mv and try_deck_mv - normal") {
+        BoardT other(deck);
+        REQUIRE(board.try_tab_mv(Tableau, 0, 1) == Illegal);
+        REQUIRE(board == other);
+        REQUIRE(board.try_tab_mv(Tableau, 1, 0) == Legal);
+        other.tab_mv(Tableau, 1, 0);
+        REQUIRE(board == other);
+        REQUIRE(board.try_waste_mv(Foundation, 0) == EmptyOrigin);
+        REQUIRE(board.try_deck_mv() == Legal);
+        REQUIRE(board.try_waste_mv(Foundation, 0) == Legal);
+        other.deck_mv();
+        other.waste_mv(Foundation, 0);
+        REQUIRE(board == other);
+    }
+    
+    SECTION("try_deck_mv - boundary") {
+        for (int i = 0; i < 64; i++)
+            REQUIRE(board.try_deck_mv() == Legal);
+        REQUIRE(board.try_deck_mv() == EmptyOrigin);
+    }
+    
+    SECTION("make - same as tab_mv, waste_mv and deck_mv") {
+        BoardT other(deck);
+        board.tab_mv(Tableau, 1, 0);
+        other.make(tab_move(Tableau, 1, 0));
+        REQUIRE(board == other);
+        board.deck_mv();
+        other.make(deck_move());
+        REQUIRE(board == other);
+        board.waste_mv(Foundation, 0);
+        other.make(waste_move(Foundation, 0));
+        REQUIRE(board == other);
+    }
+    
+    SECTION("unmake - restores board after tab_mv") {
+        BoardT original = board;
+        board.tab_mv(Foundation, 1, 0);
+        board.unmake(tab_move(Foundation, 1, 0));
+        REQUIRE(board == original);
+        REQUIRE(std::memcmp(&board, &original, sizeof(BoardT)) == 0);
+    }
+    
+    SECTION("make and unmake - random sequences restore the board bit for bit") {
+        std::mt19937 rng(2026);
+        for (int game = 0; game < 50; game++) {
+            std::vector<CardT> shuffled = deck;
+            std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            BoardT start(shuffled);
+            BoardT current = start;
+            std::vector<MoveT> made;
+            for (int step = 0; step < 200; step++) {
+                std::vector<MoveT> legal = legal_moves(current);
+                if (legal.empty())
+                    break;
+                MoveT move = legal[rng() % legal.size()];
+                current.make(move);
+                made.push_back(move);
+            }
+            while (!made.empty()) {
+                current.unmake(made.back());
+                made.pop_back();
+            }
+            REQUIRE(current == start);
+            REQUIRE(std::memcmp(&current, &start, sizeof(BoardT)) == 0);
+        }
+    }
+    
+    SECTION("generate_moves - same moves as the validation functions") {
+        std::mt19937 rng(17);
+        MoveT moves[MAX_MOVES];
+        for (int game = 0; game < 20; game++) {
+            std::vector<CardT> shuffled = deck;
+            std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            BoardT current(shuffled);
+            for (int step = 0; step < 200; step++) {
+                std::vector<MoveT> legal = legal_moves(current);
+                unsigned int n = current.generate_moves(moves);
+                REQUIRE(n == legal.size());
+                REQUIRE(current.valid_mv_exists() == (n > 0));
+                for (unsigned int i = 0; i < n; i++)
+                    REQUIRE(std::find(legal.begin(), legal.end(), moves[i]) != legal.end());
+                if (n == 0)
+                    break;
+                current.make(moves[rng() % n]);
+            }
+        }
+    }
+    
+    SECTION("auto_play_safe - sorted deal is played out") {
+        std::vector<CardT> sorted = sorted_decks();
+        BoardT sortedBoard(sorted);
+        BoardT start = sortedBoard;
+        std::vector<MoveT> made = sortedBoard.auto_play_safe();
+        REQUIRE(made.size() == 40);
+        for (int i = 0; i < TAB_SIZE; i++)
+            REQUIRE(sortedBoard.get_tab_size(i) == 0);
+        REQUIRE(sortedBoard.auto_play_safe().size() == 0);
+        //Taken back move by move
+        for (unsigned int i = made.size(); i > 0; i--)
+            sortedBoard.unmake(made[i - 1]);
+        REQUIRE(sortedBoard == start);
+        for (unsigned int i = 0; i < made.size(); i++)
+            sortedBoard.make(made[i]);
+        for (int i = 0; i < 64; i++)
+            sortedBoard.deck_mv();
+        REQUIRE(sortedBoard.auto_play_safe().size() == 64);
+        REQUIRE(sortedBoard.is_win_state());
+    }
+    
+    SECTION("auto_play_safe and is_safe_mv - a card still needed stays") {
+        //Tableau 0 holds a hearts ace under a spades king, the other hearts ace
+        //is on top of the deck
+        std::vector<CardT> sorted = sorted_decks();
+        std::swap(sorted[1], sorted[103]);
+        BoardT sortedBoard(sorted);
+        sortedBoard.auto_play_safe();
+        REQUIRE(sortedBoard.get_tab_size(0) == 2);
+        sortedBoard.deck_mv();
+        std::vector<MoveT> made = sortedBoard.auto_play_safe();
+        REQUIRE(made.size() == 1);
+        REQUIRE(made[0] == waste_move(Foundation, made[0].destination));
+        //The hearts two on tableau 2 may go to the foundation, but the buried
+        //hearts ace may need it
+        REQUIRE(sortedBoard.get_tab(2).top().s == Heart);
+        REQUIRE(sortedBoard.get_tab(2).top().r == 2);
+        REQUIRE(sortedBoard.is_valid_tab_mv(Foundation, 2, made[0].destination));
+        REQUIRE(!sortedBoard.is_safe_mv(tab_move(Foundation, 2, made[0].destination)));
+        REQUIRE(!sortedBoard.is_safe_mv(deck_move()));
+    }
+    
+    SECTION("auto_play_safe - only valid, safe moves, and none left") {
+        std::mt19937 rng(25);
+        MoveT moves[MAX_MOVES];
+        for (int game = 0; game < 50; game++) {
+            std::vector<CardT> shuffled = deck;
+            std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            BoardT current(shuffled);
+            for (int step = 0; step < 200; step++) {
+                BoardT replay = current;
+                std::vector<MoveT> made = current.auto_play_safe();
+                for (unsigned int i = 0; i < made.size(); i++) {
+                    REQUIRE(made[i].category == Foundation);
+                    if (made[i].origin_category == Tableau)
+                        REQUIRE(replay.is_valid_tab_mv(Foundation, made[i].origin, made[i].destination));
+                    else
+                        REQUIRE(replay.is_valid_waste_mv(Foundation, made[i].destination));
+                    REQUIRE(replay.is_safe_mv(made[i]));
+                    replay.make(made[i]);
+                }
+                REQUIRE(replay == current);
+                unsigned int n = current.generate_moves(moves);
+                for (unsigned int i = 0; i < n; i++)
+                    REQUIRE(!current.is_safe_mv(moves[i]));
+                if (n == 0)
+                    break;
+                current.make(moves[rng() % n]);
+            }
+        }
+    }
+    
+    SECTION("is_safe_mv - foundation heights follow make and unmake") {
+        std::mt19937 rng(26);
+        MoveT moves[MAX_MOVES];
+        for (int game = 0; game < 20; game++) {
+            std::vector<CardT> shuffled = deck;
+            std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            BoardT current(shuffled);
+            for (int step = 0; step < 300; step++) {
+                unsigned int n = current.generate_moves(moves);
+                if (n == 0)
+                    break;
+                for (unsigned int i = 0; i < n; i++) {
+                    if (moves[i].category != Foundation)
+                        continue;
+                    //Safe when no foundation of the suit is two or more ranks below the card
+                    CardT card = moves[i].origin_category == Tableau ? current.get_tab(moves[i].origin).top() : current.get_waste().top();
+                    unsigned int found = 0;
+                    unsigned int low = KING;
+                    for (int j = 0; j < FOUND_SIZE; j++) {
+                        CardStackT pile = current.get_foundation(j);
+                        if (pile.size() > 0 && pile.top().s == card.s) {
+                            found++;
+                            low = std::min(low, pile.size());
+                        }
+                    }
+                    bool safe = card.r == ACE || (found == 2 && card.r <= low + 1);
+                    REQUIRE(current.is_safe_mv(moves[i]) == safe);
+                }
+                MoveT move = moves[rng() % n];
+                current.make(move);
+                //Taking a move back now and then exercises the heights going down
+                if (rng() % 4 == 0) {
+                    current.unmake(move);
+                    current.make(move);
+                }
+            }
+        }
+    }
+    
+    SECTION("auto_play_safe - boundary") {
+        BoardT empty;
+        REQUIRE(empty.auto_play_safe().size() == 0);
+        REQUIRE(empty == BoardT());
+    }
+    
     SECTION("valid_mv_exists") {
         REQUIRE(board.valid_mv_exists());
     }
     
+    SECTION("valid_mv_exists - boundary") {
+        BoardT empty;
+        REQUIRE(!empty.valid_mv_exists());
+    }
+    
+    SECTION("valid_mv_exists - empty deck, empty tableaus and waste moves") {
+        MoveT moves[MAX_MOVES];
+        BoardT sortedBoard(sorted_decks());
+        while (sortedBoard.get_deck().size() > 0)
+            sortedBoard.deck_mv();
+        REQUIRE(sortedBoard.valid_mv_exists() == (sortedBoard.generate_moves(moves) > 0));
+        //Every tableau goes to the foundations, leaving only the waste
+        for (int i = 0; i < 10; i+=2) {
+            for (int j = 3; j >= 0; j--) {
+                sortedBoard.tab_mv(Foundation, i, j);
+                REQUIRE(sortedBoard.valid_mv_exists() == (sortedBoard.generate_moves(moves) > 0));
+                sortedBoard.tab_mv(Foundation, i+1, j+4);
+                REQUIRE(sortedBoard.valid_mv_exists() == (sortedBoard.generate_moves(moves) > 0));
+            }
+        }
+        //The waste top goes onto an empty tableau, or onto its foundation
+        REQUIRE(sortedBoard.valid_mv_exists());
+        REQUIRE(sortedBoard.is_valid_waste_mv(Tableau, 0));
+        for (int i = 0; i < 64; i++) {
+            REQUIRE(sortedBoard.valid_mv_exists() == (sortedBoard.generate_moves(moves) > 0));
+            sortedBoard.waste_mv(Foundation, i%8);
+        }
+        REQUIRE(sortedBoard.is_win_state());
+        REQUIRE(!sortedBoard.valid_mv_exists());
+        REQUIRE(sortedBoard.generate_moves(moves) == 0);
+    }
+    
+    SECTION("valid_mv_exists - empty deck, same as generate_moves") {
+        std::mt19937 rng(29);
+        MoveT moves[MAX_MOVES];
+        int emptyTabs = 0;
+        int wasteOnly = 0;
+        int stuck = 0;
+        for (int game = 0; game < 40; game++) {
+            //Shuffled deals rarely empty a tableau, nearly sorted ones often do
+            std::vector<CardT> shuffled = game % 2 == 0 ? deck : sorted_decks();
+            if (game % 2 == 0)
+                std::shuffle(shuffled.begin(), shuffled.end(), rng);
+            for (int i = 0; game % 2 == 1 && i < 8; i++)
+                std::swap(shuffled[rng() % TOTAL_CARD], shuffled[rng() % TOTAL_CARD]);
+            BoardT current(shuffled);
+            while (current.get_deck().size() > 0)
+                current.deck_mv();
+            for (int step = 0; step < 300; step++) {
+                unsigned int n = current.generate_moves(moves);
+                REQUIRE(current.valid_mv_exists() == (n > 0));
+                for (int i = 0; i < TAB_SIZE; i++) {
+                    if (current.view_tab(i).size() == 0) {
+                        emptyTabs++;
+                        break;
+                    }
+                }
+                bool fromWaste = n > 0;
+                for (unsigned int i = 0; i < n; i++)
+                    fromWaste = fromWaste && moves[i].origin_category == Waste;
+                wasteOnly += fromWaste;
+                if (n == 0) {
+                    stuck++;
+                    break;
+                }
+                current.make(moves[rng() % n]);
+            }
+        }
+        //The cases the fast path treats apart are all reached
+        REQUIRE(emptyTabs > 0);
+        REQUIRE(wasteOnly > 0);
+        REQUIRE(stuck > 0);
+    }
+    
     SECTION("is_win_state") {
         int count;
         std::vector<CardT> tempDeck;
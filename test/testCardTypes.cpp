@@ -0,0 +1,47 @@
+/**
+ * \file testCardTypes.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for the card types
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for PackedCardT
+//Test for normal and boundary cases
+TEST_CASE("Tests for PackedCardT", "[CardTypes]") {
+    
+    SECTION("pack_card and unpack_card - round trip") {
+        for (RankT rank = ACE; rank <= KING; rank++) {
+            for (unsigned int suit = 0; suit < 4; suit++) {
+                CardT card = {static_cast<SuitT>(suit), rank};
+                PackedCardT packed = pack_card(card);
+                REQUIRE(packed != 0);
+                REQUIRE(unpack_card(packed).s == card.s);
+                REQUIRE(unpack_card(packed).r == card.r);
+                REQUIRE(packed_suit(packed) == card.s);
+                REQUIRE(packed_rank(packed) == card.r);
+            }
+        }
+    }
+    
+    SECTION("pack_card - boundary") {
+        REQUIRE(pack_card({Heart, ACE}) == 4);
+        REQUIRE(pack_card({Spade, KING}) == 55);
+        REQUIRE(sizeof(PackedCardT) == 1);
+    }
+    
+    SECTION("pack_card - same suit neighbours differ by 4") {
+        REQUIRE(pack_card({Club, 7}) + 4 == pack_card({Club, 8}));
+        REQUIRE(pack_card({Club, 7}) + 4 != pack_card({Spade, 8}));
+    }
+    
+}
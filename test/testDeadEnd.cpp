@@ -0,0 +1,188 @@
+/**
+ * \file testDeadEnd.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for the dead end check
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Snapshot.h"
+#include "Deal.h"
+#include "DeadEnd.h"
+#include "Solver.h"
+#include "testHelpers.h"
+#include <vector>
+#include <cstring>
+#include <unordered_set>
+
+
+
+//===============================================================================================================================
+
+
+
+//Board with the given tableaus, empty foundations, and every other card in the deck then the waste
+static BoardT build(const std::vector<std::vector<CardT> > &tabs) {
+    int count[SUMMARY_SIZE] = {0};
+    BoardSnapshotT snapshot;
+    std::memset(&snapshot, 0, sizeof(snapshot));
+    std::memcpy(snapshot.magic, "BDSN", 4);
+    snapshot.version = SNAPSHOT_VERSION;
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < tabs.size(); i++) {
+        snapshot.lengths[i] = tabs[i].size();
+        for (unsigned int j = 0; j < tabs[i].size(); j++) {
+            snapshot.cards[n++] = pack_card(tabs[i][j]);
+            count[pack_card(tabs[i][j])]++;
+        }
+    }
+    std::vector<PackedCardT> rest;
+    std::vector<CardT> sorted = sorted_decks();
+    for (unsigned int i = 0; i < sorted.size(); i++) {
+        if (count[pack_card(sorted[i])]++ < 2)
+            rest.push_back(pack_card(sorted[i]));
+    }
+    snapshot.lengths[TAB_SIZE + FOUND_SIZE] = rest.size() < 64 ? rest.size() : 64;
+    snapshot.lengths[TAB_SIZE + FOUND_SIZE + 1] = rest.size() - snapshot.lengths[TAB_SIZE + FOUND_SIZE];
+    for (unsigned int i = 0; i < rest.size(); i++)
+        snapshot.cards[n++] = rest[i];
+    return BoardT(snapshot, false, true);
+}
+
+//Search for a win by plain depth-first search, without dead end pruning, until
+//the budget of moves runs out
+static bool winnable(BoardT &board, unsigned long &budget, std::unordered_set<uint64_t> &seen) {
+    if (board.is_win_state())
+        return true;
+    MoveT moves[MAX_MOVES];
+    unsigned int n = board.generate_moves(moves);
+    for (unsigned int i = 0; i < n && budget > 0; i++) {
+        board.make(moves[i]);
+        budget--;
+        bool won = seen.insert(board.canonical_hash()).second && winnable(board, budget, seen);
+        board.unmake(moves[i]);
+        if (won)
+            return true;
+    }
+    return false;
+}
+
+//Card of a suit and rank
+static CardT card(SuitT suit, RankT rank) {
+    CardT c = {suit, rank};
+    return c;
+}
+
+
+
+//Testing unit for the dead end check
+//Test for normal and boundary cases
+TEST_CASE("Tests for DeadEnd", "[DeadEnd]") {
+    
+    //Variables needed for testing
+    //Both aces of every suit lie under a king of that suit, which waits for
+    //the whole suit, and both hearts two lie on top of both hearts four
+    std::vector<std::vector<CardT> > tabs;
+    for (unsigned int suit = 0; suit < 4; suit++) {
+        for (int copy = 0; copy < 2; copy++) {
+            std::vector<CardT> pile;
+            pile.push_back(card(static_cast<SuitT>(suit), ACE));
+            pile.push_back(card(static_cast<SuitT>(suit), KING));
+            tabs.push_back(pile);
+        }
+    }
+    for (int copy = 0; copy < 2; copy++) {
+        std::vector<CardT> pile;
+        pile.push_back(card(Heart, 4));
+        pile.push_back(card(Heart, 2));
+        tabs.push_back(pile);
+    }
+    
+    SECTION("is_dead_end - buried aces") {
+        BoardT board = build(tabs);
+        REQUIRE(board.view_deck().size() == 64);
+        REQUIRE(board.valid_mv_exists());
+        REQUIRE(is_dead_end(board));
+        //A proven dead end is searched no further
+        SolverT solver;
+        SolveResultT result = solver.solve(board);
+        REQUIRE(result.status == Unsolvable);
+        REQUIRE(result.nodes == 0);
+        MoveT moves[MAX_MOVES];
+        REQUIRE(order_moves(board, moves, board.generate_moves(moves)) == 0);
+    }
+    
+    SECTION("is_dead_end - one ace free") {
+        std::swap(tabs[0][0], tabs[0][1]);
+        BoardT board = build(tabs);
+        REQUIRE(!is_dead_end(board));
+    }
+    
+    SECTION("is_dead_end - a tableau can be cleared") {
+        //The hearts two can go onto a hearts three, leaving its tableau empty
+        tabs[9][0] = card(Heart, 3);
+        tabs[9].pop_back();
+        BoardT board = build(tabs);
+        REQUIRE(!is_dead_end(board));
+    }
+    
+    SECTION("is_dead_end - never claims a won game") {
+        std::vector<CardT> deck;
+        for (RankT rank = ACE; rank <= KING; rank++) {
+            for (unsigned int suit = 0; suit < 4; suit++) {
+                deck.push_back(card(static_cast<SuitT>(suit), rank));
+                deck.push_back(card(static_cast<SuitT>(suit), rank));
+            }
+        }
+        BoardT board(deck);
+        MoveT moves[MAX_MOVES];
+        while (!board.is_win_state()) {
+            REQUIRE(!is_dead_end(board));
+            unsigned int n = board.generate_moves(moves);
+            REQUIRE(n > 0);
+            //Foundation moves first, else the deck
+            MoveT move = moves[n - 1];
+            for (unsigned int i = 0; i < n; i++) {
+                if (moves[i].category == Foundation) {
+                    move = moves[i];
+                    break;
+                }
+            }
+            board.make(move);
+        }
+        REQUIRE(!is_dead_end(board));
+    }
+    
+    SECTION("is_dead_end - positions proven lost are not solvable") {
+        unsigned int dead = 0;
+        for (uint64_t seed = 0; seed < 40; seed++) {
+            BoardT board = deal_board(seed);
+            DealRngT random(seed);
+            MoveT moves[MAX_MOVES];
+            for (int step = 0; step < 300; step++) {
+                if (is_dead_end(board)) {
+                    dead++;
+                    unsigned long budget = 20000;
+                    std::unordered_set<uint64_t> seen;
+                    REQUIRE(!winnable(board, budget, seen));
+                    break;
+                }
+                unsigned int n = board.generate_moves(moves);
+                if (n == 0)
+                    break;
+                board.make(moves[random.bounded(n)]);
+            }
+        }
+        REQUIRE(dead > 0);
+    }
+    
+    SECTION("is_dead_end - boundary") {
+        BoardT empty;
+        REQUIRE(!is_dead_end(empty));
+        for (uint64_t seed = 0; seed < 20; seed++)
+            REQUIRE(!is_dead_end(deal_board(seed)));
+    }
+}
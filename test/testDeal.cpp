@@ -0,0 +1,90 @@
+/**
+ * \file testDeal.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for Deal
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include <vector>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for Deal
+//Test for normal and boundary cases
+TEST_CASE("Tests for Deal", "[Deal]") {
+    
+    //Variables needed for testing
+    PackedCardT packed[TOTAL_CARD];
+    
+    SECTION("DealRngT - reference values") {
+        //First output of xoshiro256** seeded from splitmix64(0)
+        DealRngT rng(0);
+        REQUIRE(rng.next() == 11091344671253066420ULL);
+        DealRngT same(0);
+        same.next();
+        REQUIRE(rng.next() == same.next());
+    }
+    
+    SECTION("DealRngT - bounded stays below the bound") {
+        DealRngT rng(9);
+        for (int i = 0; i < 10000; i++)
+            REQUIRE(rng.bounded(7) < 7);
+        REQUIRE(rng.bounded(1) == 0);
+    }
+    
+    SECTION("deal_packed - reference deals") {
+        PackedCardT first[8] = {16, 46, 27, 13, 22, 6, 33, 52};
+        deal_packed(0, packed);
+        for (int i = 0; i < 8; i++)
+            REQUIRE(packed[i] == first[i]);
+        PackedCardT other[8] = {43, 41, 39, 17, 21, 25, 14, 23};
+        deal_packed(12345, packed);
+        for (int i = 0; i < 8; i++)
+            REQUIRE(packed[i] == other[i]);
+    }
+    
+    SECTION("deal_packed - every card twice") {
+        for (uint64_t seed = 0; seed < 100; seed++) {
+            int count[56] = {0};
+            deal_packed(seed, packed);
+            for (int i = 0; i < TOTAL_CARD; i++)
+                count[packed[i]]++;
+            for (int i = 4; i < 56; i++)
+                REQUIRE(count[i] == 2);
+        }
+    }
+    
+    SECTION("deal_cards - same as deal_packed and accepted by BoardT") {
+        std::vector<CardT> cards = deal_cards(77);
+        deal_packed(77, packed);
+        REQUIRE(cards.size() == TOTAL_CARD);
+        for (int i = 0; i < TOTAL_CARD; i++)
+            REQUIRE(pack_card(cards[i]) == packed[i]);
+        REQUIRE_NOTHROW(BoardT(cards));
+    }
+    
+    SECTION("deal_board - same board as deal_cards") {
+        for (uint64_t seed = 0; seed < 20; seed++) {
+            BoardT board = deal_board(seed);
+            REQUIRE(board == BoardT(deal_cards(seed)));
+        }
+    }
+    
+    SECTION("deal_cards - different seeds give different deals") {
+        PackedCardT other[TOTAL_CARD];
+        deal_packed(1, packed);
+        deal_packed(2, other);
+        REQUIRE(std::vector<PackedCardT>(packed, packed + TOTAL_CARD)
+                != std::vector<PackedCardT>(other, other + TOTAL_CARD));
+    }
+    
+}
@@ -0,0 +1,120 @@
+/**
+ * \file testDealDatabase.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for DealDatabase
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Solver.h"
+#include "Deal.h"
+#include "DealDatabase.h"
+#include <string>
+#include <stdexcept>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+
+
+//===============================================================================================================================
+
+
+
+//Name of a new empty temporary file
+static std::string temp_path() {
+    char name[] = "/tmp/testDealDatabaseXXXXXX";
+    int fd = mkstemp(name);
+    REQUIRE(fd >= 0);
+    close(fd);
+    return name;
+}
+
+//Write a database of the deals of a range of seeds
+static void write_deals(const std::string &path, uint64_t first, uint64_t count) {
+    DealDbWriterT writer(path);
+    PackedCardT packed[TOTAL_CARD];
+    for (uint64_t seed = first; seed < first + count; seed++) {
+        deal_packed(seed, packed);
+        REQUIRE(writer.append(packed, seed) == seed - first);
+    }
+    writer.close();
+}
+
+
+
+//Testing unit for DealDatabase
+//Test for normal, boundary and exception cases
+TEST_CASE("Tests for DealDatabase", "[DealDatabase]") {
+    
+    //Variables needed for testing
+    std::string path = temp_path();
+    
+    SECTION("DealDbWriterT, DealDbT - normal") {
+        write_deals(path, 100, 50);
+        DealDbT db(path);
+        REQUIRE(db.size() == 50);
+        REQUIRE(db.end() - db.begin() == 50);
+        for (uint64_t i = 0; i < db.size(); i++) {
+            const DealRecordT &record = db.record(i);
+            REQUIRE(record.seed == 100 + i);
+            REQUIRE(record.status == Unknown);
+            REQUIRE(record.moves == 0);
+            BoardT board = db.board(i);
+            BoardT expected = deal_board(100 + i);
+            REQUIRE(board == expected);
+            REQUIRE(board.hash() == expected.hash());
+        }
+    }
+    
+    SECTION("set_result - seen by another mapping") {
+        write_deals(path, 0, 4);
+        DealDbT writable(path, true);
+        DealDbT reader(path);
+        SolveResultT result;
+        result.status = Solved;
+        result.moves.resize(17);
+        result.nodes = 123456789012ULL;
+        result.seconds = 0;
+        writable.set_result(2, result);
+        REQUIRE(reader.record(2).status == Solved);
+        REQUIRE(reader.record(2).moves == 17);
+        REQUIRE(reader.record(2).nodes == 123456789012ULL);
+        REQUIRE(reader.record(1).status == Unknown);
+    }
+    
+    SECTION("DealDbT - boundary") {
+        write_deals(path, 0, 0);
+        DealDbT db(path);
+        REQUIRE(db.size() == 0);
+        REQUIRE(db.begin() == db.end());
+    }
+    
+    SECTION("DealDbT - exception") {
+        write_deals(path, 0, 3);
+        DealDbT db(path);
+        SolveResultT result;
+        result.status = Unsolvable;
+        result.nodes = 0;
+        result.seconds = 0;
+        REQUIRE_THROWS_AS(db.record(3), std::out_of_range);
+        REQUIRE_THROWS_AS(db.board(3), std::out_of_range);
+        REQUIRE_THROWS_AS(db.set_result(0, result), std::logic_error);
+        REQUIRE_THROWS_AS(DealDbT(path + ".missing"), std::runtime_error);
+        //A file that is not a deal database
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        for (int i = 0; i < 200; i++)
+            std::fputc('x', file);
+        std::fclose(file);
+        REQUIRE_THROWS_AS(DealDbT(path), std::invalid_argument);
+        //A file cut short
+        write_deals(path, 0, 3);
+        REQUIRE(truncate(path.c_str(), 64 + 2 * sizeof(DealRecordT)) == 0);
+        REQUIRE_THROWS_AS(DealDbT(path), std::invalid_argument);
+    }
+    
+    std::remove(path.c_str());
+}
@@ -0,0 +1,132 @@
+/**
+ * \file testFixedStack.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for FixedStack
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "FixedStack.h"
+#include "CardStack.h"
+#include <vector>
+#include <stdexcept>
+#include <cstring>
+#include <type_traits>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for FixedStack
+//Test for normal, boundary and exception cases
+TEST_CASE("Tests for FixedStack", "[FixedStack]") {
+    
+    //Variables needed for the testing
+    std::vector<PackedCardT> emptyCards;
+    std::vector<PackedCardT> cards;
+    cards.push_back(pack_card({static_cast<SuitT>(0), ACE}));
+    cards.push_back(pack_card({static_cast<SuitT>(0), 2}));
+    cards.push_back(pack_card({static_cast<SuitT>(0), 3}));
+    typedef FoundStackT TestStackT;
+    TestStackT emptyStack(emptyCards);
+    TestStackT stack(cards);
+    std::vector<PackedCardT> tempStack;
+    
+    SECTION("Constructor and toSeq - normal") {
+        tempStack = stack.toSeq();
+        REQUIRE(tempStack.size() == 3);
+        for (int i = 0; i < 3; i++) {
+            REQUIRE(packed_rank(tempStack[i]) == i+1);
+            REQUIRE(packed_suit(tempStack[i]) == 0);
+        }
+    }
+    
+    SECTION("Constructor and toSeq - boundary") {
+        REQUIRE(emptyStack.toSeq().size() == 0);
+        REQUIRE(TestStackT().size() == 0);
+    }
+    
+    SECTION("Constructor - exception") {
+        std::vector<PackedCardT> tooMany(FOUND_CAPACITY+1, cards[0]);
+        REQUIRE_THROWS_AS(TestStackT(tooMany), std::out_of_range);
+    }
+    
+    SECTION("push and pop - normal") {
+        tempStack = stack.push(pack_card({static_cast<SuitT>(0), 4})).toSeq();
+        REQUIRE(tempStack.size() == 4);
+        REQUIRE(packed_rank(tempStack[3]) == 4);
+        tempStack = stack.pop().toSeq();
+        REQUIRE(tempStack.size() == 2);
+        REQUIRE(stack.size() == 3);
+    }
+    
+    SECTION("push_inplace - exception") {
+        for (int i = 3; i < FOUND_CAPACITY; i++)
+            stack.push_inplace(cards[0]);
+        REQUIRE(stack.size() == FOUND_CAPACITY);
+        REQUIRE_THROWS_AS(stack.push_inplace(cards[0]), std::out_of_range);
+    }
+    
+    SECTION("pop_inplace and top_ref - normal") {
+        REQUIRE(packed_rank(stack.top_ref()) == 3);
+        stack.pop_inplace();
+        REQUIRE(packed_rank(stack.top_ref()) == 2);
+        REQUIRE(packed_rank(stack.top()) == 2);
+        REQUIRE(stack.size() == 2);
+    }
+    
+    SECTION("pop, top and top_ref - exception") {
+        REQUIRE_THROWS_AS(emptyStack.pop(), std::out_of_range);
+        REQUIRE_THROWS_AS(emptyStack.pop_inplace(), std::out_of_range);
+        REQUIRE_THROWS_AS(emptyStack.top(), std::out_of_range);
+        REQUIRE_THROWS_AS(emptyStack.top_ref(), std::out_of_range);
+    }
+    
+    SECTION("Bitwise equal after push_inplace and pop_inplace") {
+        FoundStackT packed;
+        packed.push_inplace(cards[0]);
+        FoundStackT copy = packed;
+        packed.push_inplace(pack_card({static_cast<SuitT>(2), KING}));
+        packed.pop_inplace();
+        REQUIRE(std::memcmp(&copy, &packed, sizeof(FoundStackT)) == 0);
+    }
+    
+    SECTION("assign - normal") {
+        PackedCardT more[4] = {cards[2], cards[1], cards[0], cards[2]};
+        stack.assign(more, 4);
+        tempStack = stack.toSeq();
+        REQUIRE(tempStack.size() == 4);
+        REQUIRE(packed_rank(tempStack[0]) == 3);
+        REQUIRE(packed_rank(tempStack[3]) == 3);
+        stack.assign(more, 1);
+        REQUIRE(stack.size() == 1);
+        REQUIRE(packed_rank(stack.top()) == 3);
+    }
+    
+    SECTION("assign - bitwise equal to pushing") {
+        PackedCardT packed[3] = {4, 8, 12};
+        FoundStackT assigned;
+        FoundStackT pushed;
+        assigned.assign(packed, 3);
+        assigned.assign(packed, 2);
+        pushed.push_inplace(4);
+        pushed.push_inplace(8);
+        REQUIRE(std::memcmp(&assigned, &pushed, sizeof(FoundStackT)) == 0);
+    }
+    
+    SECTION("assign - exception") {
+        std::vector<PackedCardT> tooMany(FOUND_CAPACITY+1, cards[0]);
+        REQUIRE_THROWS_AS(stack.assign(&tooMany[0], tooMany.size()), std::out_of_range);
+    }
+    
+    SECTION("Trivially copyable") {
+        REQUIRE(std::is_trivially_copyable<TabStackT>::value);
+        REQUIRE(std::is_trivially_copyable<FoundStackT>::value);
+        REQUIRE(std::is_trivially_copyable<PileStackT>::value);
+    }
+    
+}
@@ -0,0 +1,31 @@
+/**
+ * \file testHelpers.h
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Defines the card sequences shared by several testing units
+ */
+#ifndef A3_TEST_HELPERS_H_
+#define A3_TEST_HELPERS_H_
+
+//Importation
+#include "CardTypes.h"
+#include <vector>
+
+/**
+ * \brief Both decks in order, rank by rank from the ace and suit by suit, the two copies of a card together
+ * \return The 104 cards
+ */
+inline std::vector<CardT> sorted_decks() {
+    std::vector<CardT> cards;
+    for (RankT rank = ACE; rank <= KING; rank++) {
+        for (unsigned int suit = 0; suit < 4; suit++) {
+            CardT card = {static_cast<SuitT>(suit), rank};
+            cards.push_back(card);
+            cards.push_back(card);
+        }
+    }
+    return cards;
+}
+
+#endif
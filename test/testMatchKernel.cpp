@@ -0,0 +1,118 @@
+/**
+ * \file testMatchKernel.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for MatchKernel
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "MatchKernel.h"
+#include "Deal.h"
+#include <vector>
+#include <stdexcept>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for MatchKernel
+//Test for normal, boundary and exception cases
+TEST_CASE("Tests for MatchKernel", "[MatchKernel]") {
+    
+    //Variables needed for testing
+    KernelT kernels[3] = {ScalarKernel, Sse2Kernel, Avx2Kernel};
+    KernelT previous = match_kernel();
+    PackedCardT origins[KERNEL_ORIGINS];
+    PackedCardT accepts[KERNEL_LANES];
+    uint32_t rows[KERNEL_ORIGINS];
+    
+    SECTION("match_matrix - normal") {
+        DealRngT rng(11);
+        for (int round = 0; round < 200; round++) {
+            for (int i = 0; i < KERNEL_ORIGINS; i++)
+                origins[i] = rng.bounded(60);
+            for (int j = 0; j < KERNEL_LANES; j++)
+                accepts[j] = rng.bounded(60);
+            for (int k = 0; k < 3; k++) {
+                if (!match_kernel_supported(kernels[k]))
+                    continue;
+                set_match_kernel(kernels[k]);
+                match_matrix(origins, KERNEL_ORIGINS, accepts, rows);
+                for (int i = 0; i < KERNEL_ORIGINS; i++) {
+                    for (int j = 0; j < KERNEL_LANES; j++)
+                        REQUIRE(((rows[i] >> j) & 1) == (accepts[j] == origins[i]));
+                }
+            }
+        }
+    }
+    
+    SECTION("match_matrix - boundary") {
+        for (int j = 0; j < KERNEL_LANES; j++)
+            accepts[j] = 55;
+        origins[0] = 55;
+        origins[1] = 0;
+        for (int k = 0; k < 3; k++) {
+            if (!match_kernel_supported(kernels[k]))
+                continue;
+            set_match_kernel(kernels[k]);
+            REQUIRE(match_kernel() == kernels[k]);
+            match_matrix(origins, 2, accepts, rows);
+            REQUIRE(rows[0] == 0xFFFFFFFFu);
+            REQUIRE(rows[1] == 0);
+        }
+        //Bytes differing only in the high bit, or next to 0 and 255, never match
+        PackedCardT bytes[8] = {0, 1, 127, 128, 129, 254, 255, 55 | 128};
+        for (int j = 0; j < KERNEL_LANES; j++)
+            accepts[j] = bytes[j % 8];
+        for (int i = 0; i < 8; i++)
+            origins[i] = bytes[i];
+        for (int k = 0; k < 3; k++) {
+            if (!match_kernel_supported(kernels[k]))
+                continue;
+            set_match_kernel(kernels[k]);
+            match_matrix(origins, 8, accepts, rows);
+            for (int i = 0; i < 8; i++)
+                REQUIRE(rows[i] == 0x01010101u << i);
+        }
+        REQUIRE(match_kernel_supported(ScalarKernel));
+    }
+    
+    SECTION("generate_moves - same moves with every kernel") {
+        MoveT expected[MAX_MOVES];
+        MoveT moves[MAX_MOVES];
+        for (uint64_t seed = 0; seed < 10; seed++) {
+            BoardT board = deal_board(seed);
+            DealRngT rng(seed);
+            for (int step = 0; step < 150; step++) {
+                set_match_kernel(ScalarKernel);
+                unsigned int n = board.generate_moves(expected);
+                for (int k = 1; k < 3; k++) {
+                    if (!match_kernel_supported(kernels[k]))
+                        continue;
+                    set_match_kernel(kernels[k]);
+                    REQUIRE(board.generate_moves(moves) == n);
+                    for (unsigned int i = 0; i < n; i++)
+                        REQUIRE(moves[i] == expected[i]);
+                }
+                if (n == 0)
+                    break;
+                board.make(expected[rng.bounded(n)]);
+            }
+        }
+    }
+    
+    SECTION("set_match_kernel - exception") {
+        for (int k = 0; k < 3; k++) {
+            if (!match_kernel_supported(kernels[k]))
+                REQUIRE_THROWS_AS(set_match_kernel(kernels[k]), std::invalid_argument);
+        }
+    }
+    
+    set_match_kernel(previous);
+}
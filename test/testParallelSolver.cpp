@@ -0,0 +1,108 @@
+/**
+ * \file testParallelSolver.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for ParallelSolver
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Solver.h"
+#include "ParallelSolver.h"
+#include "Deal.h"
+#include <vector>
+#include <stdexcept>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for ParallelSolver
+//Test for normal, boundary and exception cases
+TEST_CASE("Tests for ParallelSolver", "[ParallelSolver]") {
+    
+    //Variables needed for testing
+    std::vector<CardT> deck;
+    for (RankT rank = ACE; rank <= KING; rank++) {
+        for (unsigned int suit = 0; suit < 4; suit++) {
+            CardT n = {static_cast<SuitT>(suit), rank};
+            deck.push_back(n);
+            deck.push_back(n);
+        }
+    }
+    ParallelSolverT solver(4);
+    
+    SECTION("solve - normal") {
+        SolveResultT result = solver.solve(deck);
+        REQUIRE(result.status == Solved);
+        REQUIRE(result.nodes > 0);
+        //Replay the winning line through the checked API
+        BoardT board(deck);
+        for (unsigned int i = 0; i < result.moves.size(); i++) {
+            MoveT m = result.moves[i];
+            if (m.origin_category == Tableau)
+                board.tab_mv(static_cast<CategoryT>(m.category), m.origin, m.destination);
+            else if (m.origin_category == Waste)
+                board.waste_mv(static_cast<CategoryT>(m.category), m.destination);
+            else
+                board.deck_mv();
+        }
+        REQUIRE(board.is_win_state());
+    }
+    
+    SECTION("solve - boundary") {
+        SolveResultT result = solver.solve(BoardT());
+        REQUIRE(result.status == Unsolvable);
+        REQUIRE(result.moves.size() == 0);
+        REQUIRE(result.nodes == 0);
+    }
+    
+    SECTION("solve - node limit") {
+        ParallelSolverT limited(2, 5000);
+        std::swap(deck[0], deck[103]);
+        std::swap(deck[10], deck[60]);
+        SolveResultT result = limited.solve(deck);
+        REQUIRE(result.status != Unsolvable);
+        if (result.status == Unknown)
+            REQUIRE(result.nodes >= 5000);
+    }
+    
+    SECTION("solve - more positions than the table holds") {
+        //Midgames searched out by over 65536 positions, the slots of a 1 MB table
+        uint64_t seeds[2] = {45, 150};
+        for (int i = 0; i < 2; i++) {
+            BoardT board = deal_board(seeds[i]);
+            DealRngT random(~seeds[i]);
+            MoveT moves[MAX_MOVES];
+            for (int step = 0; step < 60; step++) {
+                unsigned int n = board.generate_moves(moves);
+                if (n == 0)
+                    break;
+                unsigned int pick = random.bounded(n);
+                for (unsigned int j = 0; j < n; j++) {
+                    if (moves[j].category == Foundation) {
+                        pick = j;
+                        break;
+                    }
+                }
+                board.make(moves[pick]);
+            }
+            SolveResultT expected = SolverT().solve(board);
+            REQUIRE(expected.status != Unknown);
+            REQUIRE(expected.nodes > 65536);
+            ParallelSolverT small(4, 0, 1);
+            REQUIRE(small.solve(board).status == expected.status);
+        }
+    }
+    
+    SECTION("solve - exception") {
+        deck.pop_back();
+        REQUIRE_THROWS_AS(solver.solve(deck), std::invalid_argument);
+    }
+    
+}
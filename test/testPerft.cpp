@@ -0,0 +1,89 @@
+/**
+ * \file testPerft.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for Perft
+ */
+//Importation
+#include "catch.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Deal.h"
+#include "Perft.h"
+#include <vector>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for Perft
+//Test for normal and boundary cases
+TEST_CASE("Tests for Perft", "[Perft]") {
+    
+    //Variables needed for testing
+    BoardT board = deal_board(7);
+    
+    SECTION("perft - reference counts") {
+        //Locked in: a change to move generation must not change these
+        REQUIRE(perft(board, 6) == 4495);
+        REQUIRE(perft(board, 10) == 44299);
+    }
+    
+    SECTION("perft - agrees with perft_reference") {
+        for (uint64_t seed = 0; seed < 10; seed++) {
+            BoardT deal = deal_board(seed);
+            for (unsigned int depth = 1; depth <= 8; depth++)
+                REQUIRE(perft(deal, depth) == perft_reference(deal, depth));
+        }
+    }
+    
+    SECTION("perft_divide - normal") {
+        std::vector<DivideT> divide = perft_divide(board, 8);
+        MoveT moves[MAX_MOVES];
+        REQUIRE(divide.size() == board.generate_moves(moves));
+        uint64_t total = 0;
+        for (unsigned int i = 0; i < divide.size(); i++) {
+            REQUIRE(divide[i].move == moves[i]);
+            total += divide[i].nodes;
+        }
+        REQUIRE(total == perft(board, 8));
+    }
+    
+    SECTION("perft_distinct - normal") {
+        BoardT copy = board;
+        //Locked in as for perft
+        REQUIRE(perft_distinct(board, 12) == 2120);
+        REQUIRE(perft_distinct(board, 12, true) == 95);
+        REQUIRE(board == copy);
+        for (unsigned int depth = 1; depth <= 8; depth++) {
+            REQUIRE(perft_distinct(board, depth, true) <= perft_distinct(board, depth));
+        }
+    }
+    
+    SECTION("perft_distinct - boundary") {
+        REQUIRE(perft_distinct(board, 0) == 1);
+        REQUIRE(perft_distinct(board, 0, true) == 1);
+        MoveT moves[MAX_MOVES];
+        REQUIRE(perft_distinct(board, 1) == board.generate_moves(moves) + 1);
+        BoardT empty;
+        REQUIRE(perft_distinct(empty, 5) == 1);
+    }
+    
+    SECTION("perft - boundary") {
+        BoardT copy = board;
+        REQUIRE(perft(board, 0) == 1);
+        MoveT moves[MAX_MOVES];
+        REQUIRE(perft(board, 1) == board.generate_moves(moves));
+        perft(board, 6);
+        REQUIRE(board == copy);
+        REQUIRE(board.hash() == copy.hash());
+        //A position with no valid move is a leaf at any depth
+        BoardT empty;
+        REQUIRE(perft(empty, 5) == 1);
+        REQUIRE(perft_reference(empty, 5) == 1);
+        REQUIRE(perft_divide(empty, 5).empty());
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * \file testSimulator.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for Simulator
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Simulator.h"
+#include "testHelpers.h"
+#include <vector>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for Simulator
+//Test for normal and boundary cases
+TEST_CASE("Tests for Simulator", "[Simulator]") {
+    
+    //Variables needed for testing
+    std::vector<CardT> deck = sorted_decks();
+    DealRngT random(3);
+    
+    SECTION("run - normal") {
+        SimulatorT simulator(GreedyFoundation, 2, 300);
+        SimulationResultT result = simulator.run(50, 11);
+        REQUIRE(result.games == 50);
+        REQUIRE(result.wins <= 50);
+        REQUIRE(result.winRate == Approx(result.wins / 50.0));
+        REQUIRE(result.low <= result.winRate);
+        REQUIRE(result.high >= result.winRate);
+        REQUIRE(result.low >= 0);
+        REQUIRE(result.high <= 1);
+        REQUIRE(result.high > 0);
+    }
+    
+    SECTION("run - same seed gives same result on any number of threads") {
+        //Every game is lost, so the moves made tell the playouts apart
+        PolicyT policies[2] = {RandomPolicy, GreedyFoundation};
+        for (int p = 0; p < 2; p++) {
+            SimulatorT one(policies[p], 1, 2000);
+            SimulatorT three(policies[p], 3, 2000);
+            SimulationResultT expected = one.run(100, 5);
+            SimulationResultT result = three.run(100, 5);
+            REQUIRE(expected.moves > 0);
+            REQUIRE(result.wins == expected.wins);
+            REQUIRE(result.moves == expected.moves);
+        }
+    }
+    
+    SECTION("play - pruning dead ends gives the same outcome") {
+        //Sorted deals with a few cards swapped, mostly won, then random deals,
+        //all lost and many stopped early as dead ends
+        PolicyT policies[2] = {RandomPolicy, GreedyFoundation};
+        unsigned int games = 0;
+        unsigned int won = 0;
+        unsigned int stopped = 0;
+        for (uint64_t seed = 0; seed < 60; seed++) {
+            std::vector<CardT> cards = deck;
+            DealRngT swaps(seed);
+            for (int k = 0; k < 8; k++)
+                std::swap(cards[swaps.bounded(TOTAL_CARD)], cards[swaps.bounded(TOTAL_CARD)]);
+            BoardT start = seed < 40 ? BoardT(cards) : deal_board(seed);
+            for (int p = 0; p < 2; p++) {
+                SimulatorT pruned(policies[p], 1, 1000, true);
+                SimulatorT full(policies[p], 1, 1000, false);
+                BoardT prunedBoard = start;
+                BoardT fullBoard = start;
+                DealRngT prunedRandom(seed);
+                DealRngT fullRandom(seed);
+                unsigned long long prunedMoves = 0;
+                unsigned long long fullMoves = 0;
+                bool outcome = full.play(fullBoard, fullRandom, fullMoves);
+                REQUIRE(pruned.play(prunedBoard, prunedRandom, prunedMoves) == outcome);
+                //A won game is never stopped, so it plays the same moves
+                if (outcome) {
+                    REQUIRE(prunedMoves == fullMoves);
+                    REQUIRE(prunedBoard == fullBoard);
+                }
+                games++;
+                won += outcome;
+                stopped += prunedMoves < fullMoves;
+            }
+        }
+        REQUIRE(won > 0);
+        REQUIRE(won < games);
+        REQUIRE(stopped > 0);
+    }
+    
+    SECTION("run - boundary") {
+        SimulatorT simulator(RandomPolicy, 2);
+        SimulationResultT result = simulator.run(0, 1);
+        REQUIRE(result.games == 0);
+        REQUIRE(result.wins == 0);
+    }
+    
+    SECTION("play - sorted deal is won greedily") {
+        SimulatorT simulator(GreedyFoundation, 1);
+        BoardT board(deck);
+        REQUIRE(simulator.play(board, random));
+        REQUIRE(board.is_win_state());
+    }
+    
+    SECTION("play - no moves is lost") {
+        SimulatorT simulator(RandomPolicy, 1);
+        BoardT board;
+        REQUIRE(!simulator.play(board, random));
+    }
+    
+}
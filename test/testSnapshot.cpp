@@ -0,0 +1,244 @@
+/**
+ * \file testSnapshot.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for board snapshots
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "GameBoard.h"
+#include "Snapshot.h"
+#include "Deal.h"
+#include "testHelpers.h"
+#include <vector>
+#include <stdexcept>
+#include <cstdio>
+#include <cstring>
+
+
+
+//===============================================================================================================================
+
+
+
+//Play a number of moves chosen by a seeded generator
+static void play_random(BoardT &board, unsigned int count, uint64_t seed) {
+    DealRngT rng(seed);
+    MoveT moves[MAX_MOVES];
+    for (unsigned int i = 0; i < count; i++) {
+        unsigned int n = board.generate_moves(moves);
+        if (n == 0)
+            return;
+        board.make(moves[rng.bounded(n)]);
+    }
+}
+
+//Check that two boards agree on every pile, the hash and the moves
+static void require_same(BoardT &a, BoardT &b) {
+    REQUIRE(a == b);
+    REQUIRE(a.hash() == b.hash());
+    REQUIRE(a.valid_mv_exists() == b.valid_mv_exists());
+    REQUIRE(a.is_win_state() == b.is_win_state());
+    MoveT movesA[MAX_MOVES];
+    MoveT movesB[MAX_MOVES];
+    unsigned int n = a.generate_moves(movesA);
+    REQUIRE(b.generate_moves(movesB) == n);
+    for (unsigned int i = 0; i < n; i++)
+        REQUIRE(movesA[i] == movesB[i]);
+}
+
+
+//Snapshot of both decks in the given pile lengths, with a top card for the
+//first tableau and for the waste, and a hash that matches its cards
+static BoardSnapshotT arranged(const unsigned char lengths[SNAPSHOT_PILES], CardT top, CardT wasteTop) {
+    std::vector<CardT> sorted = sorted_decks();
+    std::vector<PackedCardT> rest;
+    bool tookTop = false;
+    bool tookWasteTop = false;
+    for (unsigned int i = 0; i < sorted.size(); i++) {
+        PackedCardT card = pack_card(sorted[i]);
+        if (!tookTop && card == pack_card(top))
+            tookTop = true;
+        else if (!tookWasteTop && card == pack_card(wasteTop))
+            tookWasteTop = true;
+        else
+            rest.push_back(card);
+    }
+    BoardSnapshotT snap = deal_board(0).snapshot();
+    std::memcpy(snap.lengths, lengths, SNAPSHOT_PILES);
+    unsigned int n = 0;
+    unsigned int k = 0;
+    for (int i = 0; i < SNAPSHOT_PILES; i++) {
+        for (unsigned int j = 0; j < lengths[i]; j++) {
+            bool last = j + 1 == lengths[i];
+            if (i == 0 && last)
+                snap.cards[n++] = pack_card(top);
+            else if (i == SNAPSHOT_PILES - 1 && last)
+                snap.cards[n++] = pack_card(wasteTop);
+            else
+                snap.cards[n++] = rest[k++];
+        }
+    }
+    return BoardT(snap, false, true).snapshot();
+}
+
+
+
+//Testing unit for board snapshots
+//Test for normal, boundary and exception cases
+TEST_CASE("Tests for Snapshot", "[Snapshot]") {
+    
+    //Variables needed for testing
+    BoardT board = deal_board(7);
+    play_random(board, 60, 7);
+    
+    SECTION("snapshot, BoardT(snapshot) - normal") {
+        for (uint64_t seed = 0; seed < 50; seed++) {
+            BoardT original = deal_board(seed);
+            play_random(original, seed * 3, seed);
+            BoardSnapshotT snap = original.snapshot();
+            BoardT checked(snap);
+            BoardT unchecked(snap, false);
+            require_same(original, checked);
+            require_same(original, unchecked);
+        }
+    }
+    
+    SECTION("BoardT(snapshot) - rehash") {
+        BoardSnapshotT snap = board.snapshot();
+        std::memset(snap.hash, 0, sizeof(snap.hash));
+        REQUIRE_THROWS_AS(BoardT(snap), std::invalid_argument);
+        REQUIRE(BoardT(snap, false).hash() == 0);
+        BoardT rehashed(snap, false, true);
+        require_same(board, rehashed);
+    }
+    
+    SECTION("snapshot - read back from raw bytes") {
+        std::vector<unsigned char> bytes(sizeof(BoardSnapshotT) + 1);
+        BoardSnapshotT snap = board.snapshot();
+        //Unaligned on purpose: the format is made of bytes only
+        std::memcpy(&bytes[1], &snap, sizeof(BoardSnapshotT));
+        const BoardSnapshotT *mapped = reinterpret_cast<const BoardSnapshotT *>(&bytes[1]);
+        BoardT loaded(*mapped);
+        require_same(board, loaded);
+    }
+    
+    SECTION("snapshot - round trip through a file with one write") {
+        std::FILE *file = std::tmpfile();
+        REQUIRE(file != NULL);
+        BoardSnapshotT snap = board.snapshot();
+        REQUIRE(std::fwrite(&snap, sizeof(snap), 1, file) == 1);
+        std::rewind(file);
+        BoardSnapshotT read;
+        REQUIRE(std::fread(&read, sizeof(read), 1, file) == 1);
+        std::fclose(file);
+        BoardT loaded(read);
+        require_same(board, loaded);
+    }
+    
+    SECTION("snapshot - boundary") {
+        BoardT fresh = deal_board(3);
+        BoardSnapshotT snap = fresh.snapshot();
+        REQUIRE(sizeof(BoardSnapshotT) == 137);
+        REQUIRE(snap.version == SNAPSHOT_VERSION);
+        for (int i = 0; i < TAB_SIZE; i++)
+            REQUIRE(snap.lengths[i] == 4);
+        REQUIRE(snap.lengths[TAB_SIZE + FOUND_SIZE] == 64);
+        REQUIRE(snap.lengths[TAB_SIZE + FOUND_SIZE + 1] == 0);
+        BoardT loaded(snap);
+        require_same(fresh, loaded);
+        //Moves made after loading keep the hash in step
+        loaded.deck_mv();
+        fresh.deck_mv();
+        require_same(fresh, loaded);
+    }
+    
+    SECTION("check_*, try_* - a full pile takes no card") {
+        //Tableau 0 is full and the five of hearts on the waste could go on its six
+        unsigned char lengths[SNAPSHOT_PILES] = {16, 4, 4, 4, 4, 4, 4, 4, 4, 4};
+        lengths[TAB_SIZE + FOUND_SIZE] = 51;
+        lengths[TAB_SIZE + FOUND_SIZE + 1] = 1;
+        BoardT full(arranged(lengths, {Heart, 6}, {Heart, 5}), false);
+        REQUIRE(full.get_tab_size(0) == TAB_CAPACITY);
+        REQUIRE(full.check_waste_mv(Tableau, 0) == Illegal);
+        REQUIRE(full.try_waste_mv(Tableau, 0) == Illegal);
+        REQUIRE_THROWS_AS(full.waste_mv(Tableau, 0), std::invalid_argument);
+        REQUIRE(full.get_tab_size(0) == TAB_CAPACITY);
+        MoveT moves[MAX_MOVES];
+        unsigned int n = full.generate_moves(moves);
+        for (unsigned int i = 0; i < n; i++)
+            REQUIRE(!(moves[i].category == Tableau && moves[i].destination == 0));
+        //A full waste takes no card from the deck
+        unsigned char pileLengths[SNAPSHOT_PILES] = {16, 4, 4, 4, 4, 4};
+        pileLengths[TAB_SIZE + FOUND_SIZE] = 4;
+        pileLengths[TAB_SIZE + FOUND_SIZE + 1] = PILE_CAPACITY;
+        BoardT fullWaste(arranged(pileLengths, {Heart, 6}, {Heart, 5}), false);
+        REQUIRE(!fullWaste.is_valid_deck_mv());
+        REQUIRE(fullWaste.try_deck_mv() == Illegal);
+        REQUIRE_THROWS_AS(fullWaste.deck_mv(), std::invalid_argument);
+        n = fullWaste.generate_moves(moves);
+        for (unsigned int i = 0; i < n; i++)
+            REQUIRE(moves[i].origin_category != Deck);
+    }
+    
+    SECTION("BoardT(snapshot) - piles no game can reach") {
+        //Sixteen cards topped by the six of hearts, with the five of hearts on the waste
+        unsigned char lengths[SNAPSHOT_PILES] = {16, 4, 4, 4, 4, 4, 4, 4, 4, 4};
+        lengths[TAB_SIZE + FOUND_SIZE] = 51;
+        lengths[TAB_SIZE + FOUND_SIZE + 1] = 1;
+        BoardSnapshotT snap = arranged(lengths, {Heart, 6}, {Heart, 5});
+        REQUIRE_THROWS_AS(BoardT(snap), std::invalid_argument);
+        //Loaded unchecked, making the move fails without ending the process
+        BoardT loaded(snap, false);
+        REQUIRE(loaded.try_waste_mv(Tableau, 0) == Illegal);
+        REQUIRE_THROWS_AS(loaded.waste_mv(Tableau, 0), std::invalid_argument);
+        //A king four cards deep fills a tableau exactly, one card more overflows it
+        lengths[0] = 4;
+        lengths[TAB_SIZE + FOUND_SIZE] = 63;
+        REQUIRE_NOTHROW(BoardT(arranged(lengths, {Spade, KING}, {Heart, 5})));
+        lengths[0] = 5;
+        lengths[TAB_SIZE + FOUND_SIZE] = 62;
+        REQUIRE_THROWS_AS(BoardT(arranged(lengths, {Spade, KING}, {Heart, 5})), std::invalid_argument);
+        //More cards in the deck and the waste than were ever dealt to the deck
+        unsigned char pileLengths[SNAPSHOT_PILES] = {4, 4, 4, 4, 4, 4, 4, 4, 4};
+        pileLengths[TAB_SIZE + FOUND_SIZE] = 4;
+        pileLengths[TAB_SIZE + FOUND_SIZE + 1] = PILE_CAPACITY;
+        snap = arranged(pileLengths, {Heart, 6}, {Heart, 5});
+        REQUIRE_THROWS_AS(BoardT(snap), std::invalid_argument);
+        REQUIRE_NOTHROW(BoardT(snap, false));
+    }
+    
+    SECTION("BoardT(snapshot) - exception") {
+        BoardSnapshotT snap = board.snapshot();
+        BoardSnapshotT bad = snap;
+        bad.magic[0] = 'X';
+        REQUIRE_THROWS_AS(BoardT(bad, false), std::invalid_argument);
+        bad = snap;
+        bad.version = SNAPSHOT_VERSION + 1;
+        REQUIRE_THROWS_AS(BoardT(bad, false), std::invalid_argument);
+        bad = snap;
+        bad.lengths[0] += 1;
+        REQUIRE_THROWS_AS(BoardT(bad, false), std::invalid_argument);
+        bad = snap;
+        bad.lengths[0] = 200;
+        REQUIRE_THROWS_AS(BoardT(bad, false), std::invalid_argument);
+        bad = snap;
+        bad.hash[3] ^= 1;
+        REQUIRE_THROWS_AS(BoardT(bad), std::invalid_argument);
+        REQUIRE_NOTHROW(BoardT(bad, false));
+        bad = snap;
+        bad.cards[0] = 0;
+        REQUIRE_THROWS_AS(BoardT(bad), std::invalid_argument);
+        //Bytes that are not cards are refused even unchecked
+        REQUIRE_THROWS_AS(BoardT(bad, false), std::invalid_argument);
+        bad.cards[3] = 250;
+        REQUIRE_THROWS_AS(BoardT(bad, false), std::invalid_argument);
+        //Two cards swapped keep the count but not the hash
+        bad = snap;
+        std::swap(bad.cards[TOTAL_CARD - 1], bad.cards[TOTAL_CARD - 2]);
+        if (bad.cards[TOTAL_CARD - 1] != snap.cards[TOTAL_CARD - 1])
+            REQUIRE_THROWS_AS(BoardT(bad), std::invalid_argument);
+    }
+}
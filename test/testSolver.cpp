@@ -0,0 +1,77 @@
+/**
+ * \file testSolver.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for Solver
+ */
+//Importation
+#include "catch.h"
+#include "CardTypes.h"
+#include "MoveTypes.h"
+#include "GameBoard.h"
+#include "Solver.h"
+#include <vector>
+#include <stdexcept>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for Solver
+//Test for normal, boundary and exception cases
+TEST_CASE("Tests for Solver", "[Solver]") {
+    
+    //Variables needed for testing
+    std::vector<CardT> deck;
+    for (RankT rank = ACE; rank <= KING; rank++) {
+        for (unsigned int suit = 0; suit < 4; suit++) {
+            CardT n = {static_cast<SuitT>(suit), rank};
+            deck.push_back(n);
+            deck.push_back(n);
+        }
+    }
+    SolverT solver;
+    
+    SECTION("solve - normal") {
+        SolveResultT result = solver.solve(deck);
+        REQUIRE(result.status == Solved);
+        REQUIRE(result.nodes > 0);
+        REQUIRE(result.nodes_per_second() >= 0);
+        //Replay the winning line through the checked API
+        BoardT board(deck);
+        for (unsigned int i = 0; i < result.moves.size(); i++) {
+            MoveT m = result.moves[i];
+            if (m.origin_category == Tableau)
+                board.tab_mv(static_cast<CategoryT>(m.category), m.origin, m.destination);
+            else if (m.origin_category == Waste)
+                board.waste_mv(static_cast<CategoryT>(m.category), m.destination);
+            else
+                board.deck_mv();
+        }
+        REQUIRE(board.is_win_state());
+    }
+    
+    SECTION("solve - boundary") {
+        SolveResultT result = solver.solve(BoardT());
+        REQUIRE(result.status == Unsolvable);
+        REQUIRE(result.moves.size() == 0);
+        REQUIRE(result.nodes == 0);
+    }
+    
+    SECTION("solve - node limit") {
+        SolverT limited(10);
+        SolveResultT result = limited.solve(deck);
+        REQUIRE(result.status == Unknown);
+        REQUIRE(result.nodes == 10);
+        REQUIRE(result.moves.size() == 0);
+    }
+    
+    SECTION("solve - exception") {
+        deck.pop_back();
+        REQUIRE_THROWS_AS(solver.solve(deck), std::invalid_argument);
+    }
+    
+}
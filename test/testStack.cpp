@@ -2,7 +2,7 @@
  * \file testStack.cpp
  * \author Mengxi Lei, leim5
  * \date Created 2019/03/18
- * \date Last modified 2019/03/22
+ * \date Last modified 2026/10/17
  * \brief Unit testing for Stack/CardStack
  */
 //Importation
@@ -90,4 +90,40 @@ TEST_CASE("Tests for Stack/CardStack", "[Stack/CardStack]") {
         REQUIRE(emptyStack.size() == 0);
     }
     
+    SECTION("push_inplace - normal") {
+        stack.push_inplace({static_cast<SuitT>(1), KING});
+        tempStack = stack.toSeq();
+        REQUIRE(tempStack.size() == 4);
+        REQUIRE(tempStack[3].r == KING);
+        REQUIRE(tempStack[3].s == 1);
+    }
+    
+    SECTION("pop_inplace - normal") {
+        stack.pop_inplace();
+        tempStack = stack.toSeq();
+        REQUIRE(tempStack.size() == 2);
+        REQUIRE(tempStack[1].r == 2);
+        REQUIRE(tempStack[1].s == 0);
+    }
+    
+    SECTION("pop_inplace - exception") {
+        REQUIRE_THROWS_AS(emptyStack.pop_inplace(), std::out_of_range);
+    }
+    
+    SECTION("top_ref - normal") {
+        REQUIRE(stack.top_ref().r == 3);
+        REQUIRE(stack.top_ref().s == 0);
+    }
+    
+    SECTION("top_ref - exception") {
+        REQUIRE_THROWS_AS(emptyStack.top_ref(), std::out_of_range);
+    }
+    
+    SECTION("push/pop - original unchanged") {
+        stack.push({static_cast<SuitT>(0), KING});
+        stack.pop();
+        REQUIRE(stack.size() == 3);
+        REQUIRE(stack.top().r == 3);
+    }
+    
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+/**
+ * \file testTransTable.cpp
+ * \author Mengxi Lei, leim5
+ * \date Created 2026/10/17
+ * \date Last modified 2026/10/17
+ * \brief Unit testing for TransTable
+ */
+//Importation
+#include "catch.h"
+#include "MoveTypes.h"
+#include "TransTable.h"
+#include <vector>
+#include <thread>
+#include <stdint.h>
+
+
+
+//===============================================================================================================================
+
+
+
+//Testing unit for TransTable
+//Test for normal, boundary and concurrent cases
+TEST_CASE("Tests for TransTable", "[TransTable]") {
+    
+    //Variables needed for testing
+    TransTableT table(1);
+    uint64_t buckets = table.capacity() / 4;
+    TransEntryT entry = {12, LowerBound, -7, tab_move(Foundation, 3, 5)};
+    TransEntryT found;
+    
+    SECTION("Constructor and capacity - normal") {
+        REQUIRE(table.capacity() == (1 << 20) / 16);
+        REQUIRE(!table.probe(42, found));
+    }
+    
+    SECTION("store and probe - normal") {
+        table.store(42, entry);
+        REQUIRE(table.probe(42, found));
+        REQUIRE(found.depth == 12);
+        REQUIRE(found.bound == LowerBound);
+        REQUIRE(found.value == -7);
+        REQUIRE(found.best == tab_move(Foundation, 3, 5));
+        REQUIRE(!table.probe(43, found));
+        REQUIRE(!table.probe(42 + buckets, found));
+    }
+    
+    SECTION("store - same key overwrites") {
+        table.store(42, entry);
+        entry.value = 100;
+        table.store(42, entry);
+        REQUIRE(table.probe(42, found));
+        REQUIRE(found.value == 100);
+    }
+    
+    SECTION("store - boundary") {
+        TransEntryT zero = {0, NoBound, 0, MoveT()};
+        table.store(0, zero);
+        REQUIRE(table.probe(0, found));
+        REQUIRE(found.depth == 0);
+        entry.depth = 60000;
+        table.store(1, entry);
+        REQUIRE(table.probe(1, found));
+        REQUIRE(found.depth == 8191);
+    }
+    
+    SECTION("insert - normal") {
+        REQUIRE(table.insert(42, entry));
+        REQUIRE(!table.insert(42, entry));
+        table.clear();
+        REQUIRE(table.insert(42, entry));
+    }
+    
+    SECTION("store - DepthPreferred replaces the shallowest entry") {
+        unsigned short depths[5] = {5, 1, 7, 9, 3};
+        for (int i = 0; i < 5; i++) {
+            entry.depth = depths[i];
+            table.store(7 + i * buckets, entry);
+        }
+        REQUIRE(!table.probe(7 + 1 * buckets, found));
+        for (int i = 0; i < 5; i++) {
+            if (i != 1)
+                REQUIRE(table.probe(7 + i * buckets, found));
+        }
+    }
+    
+    SECTION("store - AlwaysReplace replaces one entry") {
+        TransTableT always(1, AlwaysReplace);
+        for (int i = 0; i < 5; i++) {
+            entry.depth = 100 - i;
+            always.store(7 + i * buckets, entry);
+        }
+        REQUIRE(always.probe(7 + 4 * buckets, found));
+        int kept = 0;
+        for (int i = 0; i < 4; i++)
+            kept += always.probe(7 + i * buckets, found);
+        REQUIRE(kept == 3);
+    }
+    
+    SECTION("store - AlwaysReplace and DepthPreferred replace different entries") {
+        TransTableT always(1, AlwaysReplace);
+        unsigned short depths[4] = {5, 1, 7, 9};
+        for (int i = 0; i < 4; i++) {
+            entry.depth = depths[i];
+            table.store(7 + i * buckets, entry);
+            always.store(7 + i * buckets, entry);
+        }
+        //Same bucket, and the key picks slot 2 under AlwaysReplace
+        uint64_t key = 7 + 4 * buckets + (2ULL << 32);
+        entry.depth = 3;
+        table.store(key, entry);
+        always.store(key, entry);
+        REQUIRE(table.probe(key, found));
+        REQUIRE(always.probe(key, found));
+        REQUIRE(!table.probe(7 + 1 * buckets, found));
+        REQUIRE(table.probe(7 + 2 * buckets, found));
+        REQUIRE(always.probe(7 + 1 * buckets, found));
+        REQUIRE(!always.probe(7 + 2 * buckets, found));
+    }
+    
+    SECTION("insert - concurrent threads insert every key once") {
+        std::vector<std::thread> pool;
+        std::vector<int> added(4, 0);
+        for (int t = 0; t < 4; t++) {
+            pool.push_back(std::thread([&table, &added, buckets, t]() {
+                TransEntryT mine = {1, ExactBound, 0, MoveT()};
+                //Every thread inserts the same keys in the same order, three
+                //to a bucket, so none is pushed out
+                for (int i = 0; i < 30000; i++)
+                    added[t] += table.insert(i % 10000 + (i / 10000) * buckets, mine);
+            }));
+        }
+        for (int t = 0; t < 4; t++)
+            pool[t].join();
+        REQUIRE(added[0] + added[1] + added[2] + added[3] == 30000);
+    }
+    
+    SECTION("store and probe - concurrent threads never see another key's data") {
+        std::vector<std::thread> pool;
+        std::vector<int> wrong(4, 0);
+        for (int t = 0; t < 4; t++) {
+            pool.push_back(std::thread([&table, &wrong, buckets, t]() {
+                TransEntryT mine;
+                TransEntryT seen;
+                for (int i = 0; i < 20000; i++) {
+                    //Every thread hammers the same few buckets
+                    uint64_t key = (i % 64) * buckets + (i % 3) + t * 0x100000000ULL;
+                    mine.depth = key % 8000;
+                    mine.bound = ExactBound;
+                    mine.value = (short)key;
+                    mine.best = MoveT();
+                    table.store(key, mine);
+                    if (table.probe(key, seen) && (seen.depth != key % 8000 || seen.value != (short)key))
+                        wrong[t]++;
+                }
+            }));
+        }
+        for (int t = 0; t < 4; t++)
+            pool[t].join();
+        for (int t = 0; t < 4; t++)
+            REQUIRE(wrong[t] == 0);
+    }
+    
+}